@@ -0,0 +1,60 @@
+#include "benchCave.hpp"
+
+
+BenchCave::BenchCave(const GameSetup* const setup) : BasicCave(setup),
+    cannedLength(0), turnsLeft(0), drawBoard(true) {}
+
+void BenchCave::useCannedTurns(const int length, const int turns,
+    const bool board) {
+  cannedLength = length;
+  turnsLeft = turns;
+  drawBoard = board;
+
+  // The canned list replaces the player's action
+  setUpdateHandler(GameUpdate::PromptTurnAction,
+      [](const GameUpdate&) { return GameUpdate::pointer(); });
+}
+
+std::string BenchCave::turnDisplay(Player* const active) {
+  if(!drawBoard) {
+    return std::string();
+  }
+  return BasicCave::turnDisplay(active);
+}
+
+GameUpdate::pointer BenchCave::getTurnUpdate(Player* const active,
+    const bool round) {
+  if(cannedLength == 0) {
+    return BasicCave::getTurnUpdate(active, round);
+  }
+  if(turnsLeft-- == 0) {
+    return new GameUpdate(GameUpdate::ForceGameEnd);
+  }
+
+  // A mix of updates resolved by Game, by the cave, and on the next turn
+  GameUpdate::pointer update;
+  for(int i = 0; i < cannedLength; ++i) {
+    switch(i % 5) {
+    case 0:
+      update.append(new GameUpdate(GameUpdate::DisplayText, "Canned text."));
+      break;
+    case 1:
+      update.append(new GameUpdate(GameUpdate::SetPlayerActionEnabled, 1));
+      break;
+    case 2:
+      update.append(new GameUpdate(GameUpdate::WaitForMove));
+      break;
+    case 3:
+      update.append(new GameUpdate(GameUpdate::DisplayText, "Next turn."));
+      break;
+    case 4:
+      update.append(new GameUpdate(GameUpdate::EndWait));
+      break;
+    }
+  }
+  // Close any wait left open by a length that isn't a multiple of five
+  if(cannedLength % 5 > 2) {
+    update.append(new GameUpdate(GameUpdate::EndWait));
+  }
+  return update;
+}
@@ -0,0 +1,47 @@
+#ifndef BENCH_CAVE_HPP
+#define BENCH_CAVE_HPP
+
+#include "caveImpl.hpp"
+
+
+// A BasicCave that exposes its protected functions to the benchmarks, and can
+// start each turn with a canned list of updates instead of the usual prompt
+class BenchCave : public BasicCave {
+private:
+  int cannedLength;
+  int turnsLeft;
+  bool drawBoard;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Builds the cave from the given setup, like BasicCave.
+   */
+  BenchCave(const GameSetup* setup);
+
+  using BasicCave::chooseEmptyRoom;
+  using BasicCave::chooseRoom;
+  using BasicCave::getBoard;
+  using BasicCave::getPercepts;
+  using BasicCave::getRoom;
+  using BasicCave::toIndex;
+  using BasicCave::tunnel;
+  using BasicCave::tunnelCount;
+
+  /*
+   * Function: useCannedTurns
+   * Description: Makes each turn resolve a canned list of updates without
+   *    prompting the player. After the given number of turns the game is
+   *    ended, which asks the player to confirm.
+   * Parameters:
+   *    length (int): The number of updates in each canned list.
+   *    turns (int): The number of turns to play.
+   *    board (bool): Whether to draw the board each turn.
+   */
+  void useCannedTurns(int length, int turns, bool board);
+
+  std::string turnDisplay(Player* active) override;
+  GameUpdate::pointer getTurnUpdate(Player* active, bool round) override;
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * Description: Runs the benchmarks for the engine's hot paths and prints how
+ *    long each operation takes and how many heap allocations it makes.
+ *
+ *    Usage: wumpus-bench [--filter TEXT] [--min-time SECONDS] [--json]
+ *      --filter TEXT: Only runs benchmarks whose names contain TEXT.
+ *      --min-time SECONDS: The shortest run to measure (default 0.25).
+ *      --json: Prints one JSON object per benchmark instead of a table, for
+ *        tracking results over time.
+ */
+
+#include <cstdio>
+#include <string>
+
+#include "benchmarks.hpp"
+
+
+int main(int argc, char** argv) {
+  std::string filter;
+  double minSeconds = 0.25;
+  BenchmarkSuite::Format format = BenchmarkSuite::Text;
+
+  for(int i = 1; i < argc; ++i) {
+    std::string option = argv[i];
+    if(option == "--json") {
+      format = BenchmarkSuite::Json;
+    } else if(i + 1 < argc && option == "--filter") {
+      filter = argv[++i];
+    } else if(i + 1 < argc && option == "--min-time") {
+      minSeconds = std::stod(argv[++i]);
+    } else {
+      std::fprintf(stderr, "Usage: %s [--filter TEXT] [--min-time SECONDS] "
+          "[--json]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  BenchmarkSuite suite;
+  addUpdateBenchmarks(suite);
+  addGameBenchmarks(suite);
+  addCaveBenchmarks(suite);
+  addSetupBenchmarks(suite);
+  addGraphBenchmarks(suite);
+  addBitboardBenchmarks(suite);
+
+  if(suite.run(filter, minSeconds, format) == 0) {
+    std::fprintf(stderr, "No benchmarks match the filter: %s\n",
+        filter.c_str());
+    return 1;
+  }
+  return 0;
+}
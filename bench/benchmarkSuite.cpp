@@ -0,0 +1,104 @@
+#include "benchmarkSuite.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "updateArena.hpp"
+
+
+static std::size_t allocationCount = 0;
+
+void* operator new(std::size_t size) {
+  allocationCount++;
+  void* block = std::malloc(size ? size : 1);
+  if(!block) {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+void operator delete(void* block) noexcept {
+  std::free(block);
+}
+void operator delete(void* block, std::size_t) noexcept {
+  std::free(block);
+}
+
+std::size_t heapAllocations() {
+  return allocationCount;
+}
+
+
+
+void BenchmarkSuite::add(const std::string& name, Operation operation) {
+  benchmarks.push_back({ name, std::move(operation), nullptr, nullptr });
+}
+
+void BenchmarkSuite::add(const std::string& name, Hook setup,
+    Operation operation, Hook teardown) {
+  benchmarks.push_back({ name, std::move(operation), std::move(setup),
+      std::move(teardown) });
+}
+
+int BenchmarkSuite::run(const std::string& filter, const double minSeconds,
+    const Format format) const {
+  typedef std::chrono::steady_clock Clock;
+
+  if(format == Text) {
+    std::printf("%-40s %12s %14s %14s\n", "benchmark", "iterations",
+        "ns/op", "allocs/op");
+  }
+
+  int count = 0;
+  for(const Benchmark& b : benchmarks) {
+    if(b.name.find(filter) == std::string::npos) {
+      continue;
+    }
+
+    if(b.setup) {
+      b.setup();
+    }
+    // Warm up so that one-time setup isn't measured
+    b.operation(1);
+    UpdateArena::local().reset();
+
+    long iterations = 1;
+    double seconds = 0;
+    std::size_t allocations = 0;
+    while(true) {
+      std::size_t startAllocations = heapAllocations();
+      Clock::time_point start = Clock::now();
+      b.operation(iterations);
+      seconds = std::chrono::duration<double>(Clock::now() - start).count();
+      allocations = heapAllocations() - startAllocations;
+      UpdateArena::local().reset();
+
+      if(seconds >= minSeconds) {
+        break;
+      }
+      // Aim a little past the minimum time so one more run is usually enough
+      double scale = seconds > 0 ? minSeconds / seconds * 1.2 : 10;
+      iterations = std::max(iterations * 2,
+          (long)((double)iterations * std::min(scale, 100.0)));
+    }
+    if(b.teardown) {
+      b.teardown();
+    }
+
+    double nsPerOp = seconds * 1e9 / (double)iterations;
+    double allocsPerOp = (double)allocations / (double)iterations;
+    if(format == Json) {
+      std::printf("{\"benchmark\":\"%s\",\"iterations\":%ld,"
+          "\"ns_per_op\":%.2f,\"allocs_per_op\":%.3f}\n", b.name.c_str(),
+          iterations, nsPerOp, allocsPerOp);
+    } else {
+      std::printf("%-40s %12ld %14.1f %14.3f\n", b.name.c_str(), iterations,
+          nsPerOp, allocsPerOp);
+    }
+    std::fflush(stdout);
+    count++;
+  }
+  return count;
+}
@@ -0,0 +1,84 @@
+#ifndef BENCHMARK_SUITE_HPP
+#define BENCHMARK_SUITE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/*
+ * Function: heapAllocations
+ * Description: Every call to the global operator new in the benchmark program
+ *    is counted, so benchmarks can report allocations per operation.
+ * Returns (size_t): The number of heap allocations made so far.
+ */
+std::size_t heapAllocations();
+
+
+// Times a list of named operations and reports the results
+class BenchmarkSuite {
+public:
+  // Performs the measured operation the given number of times. Any setup
+  // that shouldn't be measured per operation is amortized over the calls.
+  typedef std::function<void(long iterations)> Operation;
+  // Prepares for or cleans up after a benchmark, outside of the timed runs
+  typedef std::function<void()> Hook;
+
+  enum Format {
+    Text,
+    Json,
+  };
+
+private:
+  struct Benchmark {
+    std::string name;
+    Operation operation;
+    Hook setup;
+    Hook teardown;
+  };
+
+  std::vector<Benchmark> benchmarks;
+
+public:
+  /*
+   * Function: add
+   * Description: Adds a benchmark to the suite.
+   * Parameters:
+   *    name (string): A unique name, with parts separated by slashes, such as
+   *      "cave/getBoard/30x30".
+   *    operation (Operation): The operation to measure.
+   */
+  void add(const std::string& name, Operation operation);
+
+  /*
+   * Function: add
+   * Description: Adds a benchmark to the suite whose setup is too slow to be
+   *    amortized over the calls, such as writing a file for it to read.
+   * Parameters:
+   *    name (string): A unique name, as above.
+   *    setup (Hook): Called once before the benchmark is run.
+   *    operation (Operation): The operation to measure.
+   *    teardown (Hook): Called once after the benchmark has been run.
+   */
+  void add(const std::string& name, Hook setup, Operation operation,
+      Hook teardown);
+
+  /*
+   * Function: run
+   * Description: Runs each benchmark whose name contains the filter, growing
+   *    the number of iterations until a run takes at least the minimum time.
+   *    Only the benchmarks that are run have their setup and teardown
+   *    called. Prints one result per benchmark to stdout.
+   * Parameters:
+   *    filter (string): Only benchmarks whose names contain this are run.
+   *    minSeconds (double): The shortest run to measure.
+   *    format (Format): Text for a table, or Json for one JSON object per
+   *      line with the fields benchmark, iterations, ns_per_op and
+   *      allocs_per_op.
+   * Returns (int): The number of benchmarks run.
+   */
+  int run(const std::string& filter, double minSeconds, Format format) const;
+};
+
+#endif
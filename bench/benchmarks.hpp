@@ -0,0 +1,19 @@
+/*
+ * The functions that add each group of benchmarks to the suite. Each is
+ *    defined in the file named after its group.
+ */
+
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include "benchmarkSuite.hpp"
+
+
+void addUpdateBenchmarks(BenchmarkSuite& suite);
+void addGameBenchmarks(BenchmarkSuite& suite);
+void addCaveBenchmarks(BenchmarkSuite& suite);
+void addSetupBenchmarks(BenchmarkSuite& suite);
+void addGraphBenchmarks(BenchmarkSuite& suite);
+void addBitboardBenchmarks(BenchmarkSuite& suite);
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Description: Benchmarks for the Bitboard operations the cave uses to track
+ *    its occupied rooms, on boards from a small cave up to caves stored
+ *    sparsely.
+ */
+
+#include "benchmarks.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "bitboard.hpp"
+#include "random.hpp"
+
+
+/*
+ * Function: randomBoard
+ * Description: Sets about one room in eight, like a crowded cave.
+ * Parameters:
+ *    size (int): The width and height of the board.
+ *    setCount (int&): Set to the number of rooms whose bit was set.
+ * Returns (Bitboard): The board of set rooms.
+ */
+static Bitboard randomBoard(const int size, int& setCount) {
+  Random random(1);
+  Bitboard board(size, size);
+  setCount = 0;
+  for(int i = 0; i < size * size / 8; ++i) {
+    RoomIndex room = random.index(size * size);
+    if(!board.test(room)) {
+      board.set(room);
+      setCount++;
+    }
+  }
+  return board;
+}
+
+
+void addBitboardBenchmarks(BenchmarkSuite& suite) {
+  for(int size : { 30, 1000 }) {
+    std::string dims = "/" + std::to_string(size) + "x" + std::to_string(size);
+
+    // Moves an occupant from one room to another, as the cave does when an
+    // object moves
+    suite.add("bitboard/move" + dims, [size](const long iterations) {
+      int setCount = 0;
+      Bitboard board = randomBoard(size, setCount);
+      Random random(2);
+      RoomIndex from = board.find(0, true);
+      for(long i = 0; i < iterations; ++i) {
+        RoomIndex to = random.index(board.size());
+        if(!board.test(to)) {
+          board.reset(from);
+          board.set(to);
+          from = to;
+        }
+      }
+      if(!board.test(from)) {
+        throw std::logic_error("The occupant was lost.");
+      }
+    });
+
+    // Picks a random clear room, as SparseCave does once it is crowded
+    suite.add("bitboard/find" + dims, [size](const long iterations) {
+      int setCount = 0;
+      Bitboard board = randomBoard(size, setCount);
+      const int clear = board.size() - setCount;
+      Random random(2);
+      long total = 0;
+      for(long i = 0; i < iterations; ++i) {
+        RoomIndex room = board.find(random.index(clear), false);
+        if(board.test(room)) {
+          throw std::logic_error("A clear room wasn't found.");
+        }
+        total += room;
+      }
+      if(total < 0) {
+        throw std::logic_error("A clear room wasn't found.");
+      }
+    });
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * Description: Benchmarks for drawing the board and gathering percepts, at
+ *    cave sizes up to the largest a player can choose, and for drawing larger
+ *    caves.
+ */
+
+#include "benchmarks.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "arrowTrigger.hpp"
+#include "batSwarm.hpp"
+#include "benchCave.hpp"
+#include "bottomlessPit.hpp"
+#include "defaultEvent.hpp"
+#include "gameSetupImpl.hpp"
+#include "playerImpl.hpp"
+#include "room.hpp"
+#include "wumpus.hpp"
+
+
+// A set up cave with one player, ready to be displayed
+struct BenchBoard {
+  DefaultEvent defaultEvent;
+  BasicSetup setup;
+  BenchCave* cave;
+  Player* player;
+
+  BenchBoard(const int size) : setup(&defaultEvent), cave(nullptr) {
+    setup.setSetupVar(GameSetup::GameMode, 0);
+    setup.setSetupVar(GameSetup::Height, size);
+    setup.setSetupVar(GameSetup::Width, size);
+    setup.setSetupVar(GameSetup::Seed, 1);
+    player = new BasicPlayer();
+    Player* added = player;
+    setup.addPlayer(added);
+    setup.init();
+
+    cave = new BenchCave(&setup);
+    setup.clearEvents();
+    cave->updateState(GameUpdate(GameUpdate::CreateObject, player));
+  }
+
+  ~BenchBoard() {
+    delete cave;
+  }
+};
+
+
+void addCaveBenchmarks(BenchmarkSuite& suite) {
+  // Drawing is also measured past the largest board a player can choose, for
+  // caves loaded from files
+  for(int size : { 4, 10, 30, 100, 300 }) {
+    std::string dims = "/" + std::to_string(size) + "x" + std::to_string(size);
+
+    suite.add("cave/getBoard" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      std::size_t length = 0;
+      for(long i = 0; i < iterations; ++i) {
+        length += board.cave->getBoard().size();
+      }
+      if(length == 0) {
+        throw std::logic_error("The board was empty.");
+      }
+    });
+
+    suite.add("cave/turnDisplay" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      std::size_t length = 0;
+      for(long i = 0; i < iterations; ++i) {
+        length += board.cave->turnDisplay(board.player).size();
+      }
+      if(length == 0) {
+        throw std::logic_error("The display was empty.");
+      }
+    });
+
+    // In an 80x24 terminal, only the rooms around the player are drawn
+    suite.add("cave/turnDisplayView" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      board.cave->setViewSize(24, 80);
+      std::size_t length = 0;
+      for(long i = 0; i < iterations; ++i) {
+        length += board.cave->turnDisplay(board.player).size();
+      }
+      if(length == 0) {
+        throw std::logic_error("The display was empty.");
+      }
+    });
+  }
+
+  for(int size : { 4, 10, 30 }) {
+    std::string dims = "/" + std::to_string(size) + "x" + std::to_string(size);
+
+    suite.add("cave/chooseEmptyRoom" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      long total = 0;
+      for(long i = 0; i < iterations; ++i) {
+        total += board.cave->chooseEmptyRoom().row;
+      }
+      if(total < 0) {
+        throw std::logic_error("A room was chosen outside the cave.");
+      }
+    });
+
+    suite.add("cave/triggerEvent" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      // An arrow outside the Wumpus's room wakes it without changing the cave
+      ArrowTrigger arrow(board.player->getLocation());
+      const GameUpdate trigger(GameUpdate::TriggerEvent, &arrow,
+          Wumpus::eventName);
+      long found = 0;
+      for(long i = 0; i < iterations; ++i) {
+        found += board.cave->updateState(trigger) ? 1 : 0;
+      }
+      if(found != iterations) {
+        throw std::logic_error("The Wumpus wasn't triggered.");
+      }
+    });
+
+    suite.add("cave/getTurnUpdate" + dims, [size](const long iterations) {
+      BenchBoard board(size);
+      long updates = 0;
+      for(long i = 0; i < iterations; ++i) {
+        updates += board.cave->BasicCave::getTurnUpdate(board.player, true)
+            ? 1 : 0;
+      }
+      if(updates != 0) {
+        throw std::logic_error("The base game events made turn updates.");
+      }
+    });
+  }
+
+  suite.add("room/getPercepts", [](const long iterations) {
+    DefaultEvent defaultEvent;
+    Room room({ 0, 0 });
+    room.setDefaultEvent(&defaultEvent);
+    room.addEvent(new Wumpus(defaultEvent.clone()));
+    room.addEvent(new BatSwarm(defaultEvent.clone()));
+    room.addEvent(new BottomlessPit(defaultEvent.clone()));
+
+    Random random(1);
+    std::size_t length = 0;
+    for(long i = 0; i < iterations; ++i) {
+      length += room.getPercepts(0, random).size();
+    }
+    if(length == 0) {
+      throw std::logic_error("The room had no percepts.");
+    }
+  });
+}
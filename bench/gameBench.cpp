@@ -0,0 +1,55 @@
+/*
+ * Description: Benchmarks for Game::resolveTurn, playing turns made of canned
+ *    update lists on a headless game.
+ */
+
+#include "benchmarks.hpp"
+
+#include <string>
+
+#include "benchCave.hpp"
+#include "game.hpp"
+#include "gameIOImpl.hpp"
+#include "loadMods.hpp"
+
+
+/*
+ * Function: playCannedTurns
+ * Description: Plays a headless game where each turn resolves a canned list
+ *    of updates, then confirms the exit once the turns are done.
+ * Parameters:
+ *    length (int): The number of updates in each turn's list.
+ *    turns (long): The number of turns to play.
+ *    board (bool): Whether to draw the board each turn.
+ */
+static void playCannedTurns(const int length, const long turns,
+    const bool board) {
+  LoadMods mods("", {
+    { GameSetup::GameMode, 0 },
+    { GameSetup::Height, 10 },
+    { GameSetup::Width, 10 },
+    { GameSetup::Seed, 1 },
+  });
+  BenchCave cave(mods.getSetup());
+  cave.useCannedTurns(length, (int)turns, board);
+
+  ScriptedIO io({ 'y' });
+  Game game(mods.getSetup(), &cave, &io);
+  game.playGame();
+}
+
+
+void addGameBenchmarks(BenchmarkSuite& suite) {
+  for(int length : { 16, 256 }) {
+    std::string size = "/" + std::to_string(length);
+
+    // One operation is one turn
+    suite.add("game/resolveTurn" + size, [length](const long iterations) {
+      playCannedTurns(length, iterations, false);
+    });
+  }
+
+  suite.add("game/resolveTurn/16/board", [](const long iterations) {
+    playCannedTurns(16, iterations, true);
+  });
+}
@@ -0,0 +1,126 @@
+/*
+ * Description: Benchmarks for building cave graphs and walking the tunnels
+ *    out of their rooms, on graphs with up to millions of tunnels.
+ */
+
+#include "benchmarks.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "caveGraph.hpp"
+#include "random.hpp"
+
+
+/*
+ * Function: randomTunnels
+ * Description: Joins each room to three random rooms, so every room has about
+ *    six tunnels like a cave with a twisty layout.
+ * Returns (vector<Tunnel>): The tunnels between the rooms.
+ */
+static std::vector<CaveGraph::Tunnel> randomTunnels(const int rooms) {
+  Random random(1);
+  std::vector<CaveGraph::Tunnel> edges;
+  edges.reserve(rooms * 3);
+  for(RoomIndex i = 0; i < rooms; ++i) {
+    for(int j = 0; j < 3; ++j) {
+      edges.push_back({ i, random.index(rooms) });
+    }
+  }
+  return edges;
+}
+
+
+/*
+ * Function: flyArrow
+ * Description: Follows the path of an arrow fired down a tunnel, the way
+ *    BasicCave moves it, and checks that it reaches a new room at each hop.
+ * Parameters:
+ *    graph (CaveGraph): The cave to fire the arrow in.
+ *    room (RoomIndex): The room the arrow is fired from.
+ *    slot (int): The tunnel the arrow is fired down.
+ *    hops (int): The number of rooms the arrow flies.
+ * Returns (RoomIndex): The room the arrow stops in.
+ * Effects: Throws std::logic_error if the arrow stops early or comes back to
+ *    a room it has already been in.
+ */
+static RoomIndex flyArrow(const CaveGraph& graph, RoomIndex room, int slot,
+    const int hops) {
+  std::vector<RoomIndex> path;
+  path.reserve(hops + 1);
+  path.push_back(room);
+  for(int i = 0; i < hops; ++i) {
+    RoomIndex next = graph.tunnel(room, slot);
+    for(RoomIndex visited : path) {
+      if(next == visited) {
+        throw std::logic_error("An arrow fired down tunnel " +
+            std::to_string(slot + 1) + " from room " +
+            std::to_string(path[0] + 1) + " didn't reach " +
+            std::to_string(hops) + " new rooms.");
+      }
+    }
+    path.push_back(next);
+    slot = graph.continueTunnel(room, next, slot);
+    room = next;
+  }
+  return room;
+}
+
+
+void addGraphBenchmarks(BenchmarkSuite& suite) {
+  // Fires a 3 room shot down every tunnel of the dodecahedron, which has no
+  // loops shorter than 5 rooms, so every shot should reach 3 new rooms
+  suite.add("graph/arrowFlight/dodecahedron", [](const long iterations) {
+    const CaveGraph graph = CaveGraph::dodecahedron();
+    long total = 0;
+    for(long i = 0; i < iterations; ++i) {
+      for(RoomIndex room = 0; room < graph.roomCount(); ++room) {
+        for(int slot = 0; slot < graph.tunnelCount(room); ++slot) {
+          total += flyArrow(graph, room, slot, 3);
+        }
+      }
+    }
+    if(total < 0) {
+      throw std::logic_error("An arrow left the cave.");
+    }
+  });
+
+  for(int rooms : { 20, 10000, 1000000 }) {
+    std::string size = "/" + std::to_string(rooms);
+
+    suite.add("graph/build" + size, [rooms](const long iterations) {
+      std::vector<CaveGraph::Tunnel> edges = randomTunnels(rooms);
+      long total = 0;
+      for(long i = 0; i < iterations; ++i) {
+        CaveGraph graph(rooms, edges);
+        total += graph.roomCount();
+      }
+      if(total != rooms * iterations) {
+        throw std::logic_error("The graph lost rooms.");
+      }
+    });
+
+    // Building the graph is timed along with the sweep, so only sweep graphs
+    // that are quick to build
+    if(rooms > 10000) {
+      continue;
+    }
+    // Visits every tunnel once per iteration
+    suite.add("graph/sweepTunnels" + size, [rooms](const long iterations) {
+      CaveGraph graph(rooms, randomTunnels(rooms));
+      long total = 0;
+      for(long i = 0; i < iterations; ++i) {
+        for(RoomIndex room = 0; room < rooms; ++room) {
+          for(const RoomIndex* t = graph.begin(room); t != graph.end(room);
+              ++t) {
+            total += *t;
+          }
+        }
+      }
+      if(total < 0) {
+        throw std::logic_error("A tunnel led outside the cave.");
+      }
+    });
+  }
+}
@@ -0,0 +1,101 @@
+/*
+ * Description: Benchmarks for setting up a game: placing events with
+ *    BasicSetup::init, and the whole LoadMods startup, up to caves large
+ *    enough to be stored sparsely, both with the usual random placement and
+ *    from a saved cave.
+ */
+
+#include "benchmarks.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "caveImpl.hpp"
+#include "caveSnapshot.hpp"
+#include "defaultEvent.hpp"
+#include "gameSetupImpl.hpp"
+#include "loadMods.hpp"
+#include "playerImpl.hpp"
+
+
+/*
+ * Function: saveBenchCave
+ * Description: Sets up a square cave and saves it, with its player starting
+ *    at the escape rope.
+ * Parameters:
+ *    size (int): The width and height of the cave.
+ *    path (string): The file to save the cave to.
+ */
+static void saveBenchCave(const int size, const std::string& path) {
+  LoadMods mods("", {
+    { GameSetup::GameMode, 0 },
+    { GameSetup::Height, size },
+    { GameSetup::Width, size },
+    { GameSetup::Seed, 1 },
+  });
+  const BasicCave* cave = dynamic_cast<const BasicCave*>(mods.getCave());
+  if(!cave) {
+    throw std::logic_error("The base game cave isn't a BasicCave.");
+  }
+  // The game hasn't added its player to the cave yet
+  CaveSnapshot snapshot = cave->getSnapshot();
+  RoomPos start = mods.getSetup()->getPlayers().front()->getLocation();
+  snapshot.addSpawn(start.row * size + start.col);
+  snapshot.save(path);
+}
+
+
+void addSetupBenchmarks(BenchmarkSuite& suite) {
+  // Past 256x256 LoadMods stores the cave sparsely
+  for(int size : { 4, 10, 30, 200, 1000 }) {
+    std::string dims = "/" + std::to_string(size) + "x" + std::to_string(size);
+
+    suite.add("setup/init" + dims, [size](const long iterations) {
+      DefaultEvent defaultEvent;
+      for(long i = 0; i < iterations; ++i) {
+        BasicSetup setup(&defaultEvent);
+        setup.setSetupVar(GameSetup::GameMode, 0);
+        setup.setSetupVar(GameSetup::Height, size);
+        setup.setSetupVar(GameSetup::Width, size);
+        setup.setSetupVar(GameSetup::Seed, (int)i);
+        Player* player = new BasicPlayer();
+        setup.addPlayer(player);
+        setup.init();
+      }
+    });
+
+    suite.add("loadMods/startup" + dims, [size](const long iterations) {
+      for(long i = 0; i < iterations; ++i) {
+        LoadMods mods("", {
+          { GameSetup::GameMode, 0 },
+          { GameSetup::Height, size },
+          { GameSetup::Width, size },
+          { GameSetup::Seed, (int)i },
+        });
+      }
+    });
+
+    // Setting up and saving the cave isn't timed, so only loading it is
+    const std::string path = (std::filesystem::temp_directory_path() /
+        ("wumpus-bench-cave-" + std::to_string(size))).string();
+    suite.add("loadMods/snapshot" + dims, [size, path]() {
+      saveBenchCave(size, path);
+    }, [path](const long iterations) {
+      for(long i = 0; i < iterations; ++i) {
+        CaveSnapshot snapshot;
+        snapshot.load(path);
+        LoadMods mods;
+        mods.setSetupVars({
+          { GameSetup::GameMode, 0 },
+          { GameSetup::Seed, (int)i },
+        });
+        mods.setSnapshot(&snapshot);
+        mods.loadObjs();
+      }
+    }, [path]() {
+      std::remove(path.c_str());
+    });
+  }
+}
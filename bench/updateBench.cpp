@@ -0,0 +1,78 @@
+/*
+ * Description: Benchmarks for building and consuming GameUpdate lists, the
+ *    way events build them and Game::resolveTurn consumes them.
+ */
+
+#include "benchmarks.hpp"
+
+#include <string>
+
+#include "gameUpdatePointer.hpp"
+#include "updateArena.hpp"
+
+
+/*
+ * Function: buildList
+ * Description: Appends the given number of updates to a new list.
+ * Returns (GameUpdate::pointer): The list built.
+ */
+static GameUpdate::pointer buildList(const int length) {
+  GameUpdate::pointer update;
+  for(int i = 0; i < length; ++i) {
+    update.append(new GameUpdate(GameUpdate::SetPlayerActionEnabled, i));
+  }
+  return update;
+}
+
+/*
+ * Function: consumeList
+ * Description: Walks through a list with moveToNext, freeing each update, and
+ *    optionally inserting a follow-up update after every fourth one like
+ *    resolveUpdate does.
+ * Returns (int): The number of updates resolved.
+ */
+static int consumeList(GameUpdate::pointer& update, const bool insert) {
+  int resolved = 0;
+  while(update) {
+    if(!update.empty()) {
+      resolved++;
+      if(insert && update->getInfo() % 4 == 0) {
+        update.insertNext(new GameUpdate(GameUpdate::EndWait));
+      }
+    }
+    update.moveToNext();
+  }
+  return resolved;
+}
+
+
+void addUpdateBenchmarks(BenchmarkSuite& suite) {
+  for(int length : { 64, 4096 }) {
+    std::string size = "/" + std::to_string(length);
+
+    // One operation is a whole list, so results are per list
+    suite.add("pointer/append" + size, [length](const long iterations) {
+      for(long i = 0; i < iterations; ++i) {
+        GameUpdate::pointer update = buildList(length);
+        update.deleteNext();
+        UpdateArena::local().reset();
+      }
+    });
+
+    suite.add("pointer/moveToNext" + size, [length](const long iterations) {
+      for(long i = 0; i < iterations; ++i) {
+        GameUpdate::pointer update = buildList(length);
+        consumeList(update, false);
+        UpdateArena::local().reset();
+      }
+    });
+
+    suite.add("pointer/insertNext" + size, [length](const long iterations) {
+      for(long i = 0; i < iterations; ++i) {
+        GameUpdate::pointer update = buildList(length);
+        consumeList(update, true);
+        UpdateArena::local().reset();
+      }
+    });
+  }
+}
@@ -0,0 +1,62 @@
+#include "bitboard.hpp"
+
+#include <bitset>
+
+
+// Counts the set bits of a word, using a popcount instruction where the
+// target has one
+static int popcount(const Bitboard::Word word) {
+#if defined(__GNUC__)
+  return __builtin_popcountll(word);
+#else
+  return (int)std::bitset<Bitboard::wordBits>(word).count();
+#endif
+}
+
+
+
+Bitboard::Bitboard() : height(0), width(0) {}
+
+Bitboard::Bitboard(const int height, const int width) : height(height),
+    width(width), words((height * width + wordBits - 1) / wordBits, 0) {}
+
+void Bitboard::set(const RoomIndex index) {
+  words[index / wordBits] |= (Word)1 << (index % wordBits);
+}
+void Bitboard::reset(const RoomIndex index) {
+  words[index / wordBits] &= ~((Word)1 << (index % wordBits));
+}
+bool Bitboard::test(const RoomIndex index) const {
+  return (words[index / wordBits] >> (index % wordBits)) & 1;
+}
+
+int Bitboard::size() const {
+  return height * width;
+}
+
+RoomIndex Bitboard::find(int rank, const bool value) const {
+  const int count = (int)words.size();
+  for(int i = 0; i < count; ++i) {
+    Word word = value ? words[i] : ~words[i];
+    if(i == count - 1 && size() % wordBits != 0) {
+      // Don't count the padding as clear rooms
+      word &= ((Word)1 << (size() % wordBits)) - 1;
+    }
+
+    const int inWord = popcount(word);
+    if(rank >= inWord) {
+      rank -= inWord;
+      continue;
+    }
+    // The room is in this word, so clear the lower matching bits
+    for(; rank > 0; --rank) {
+      word &= word - 1;
+    }
+    int bit = 0;
+    while(!((word >> bit) & 1)) {
+      ++bit;
+    }
+    return i * wordBits + bit;
+  }
+  return NONE;
+}
@@ -0,0 +1,68 @@
+#ifndef BITBOARD_HPP
+#define BITBOARD_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "htwTypes.hpp"
+
+
+// One bit for each room of a cave, in row-major order by RoomIndex, packed 64
+// rooms to a word, such as the rooms that are occupied. Finding a room by its
+// rank skips a word at a time by its popcount, instead of visiting each room.
+class Bitboard {
+public:
+  typedef std::uint64_t Word;
+  static constexpr int wordBits = 64;
+
+private:
+  int height;
+  int width;
+  std::vector<Word> words;
+
+public:
+  /*
+   * Function: Default Constructor
+   * Description: Creates a board with no rooms.
+   */
+  Bitboard();
+
+  /*
+   * Function: Constructor
+   * Description: Creates a board of the given size with every bit clear.
+   * Parameters:
+   *    height (int): The number of rows of rooms.
+   *    width (int): The number of columns of rooms.
+   */
+  Bitboard(int height, int width);
+
+  /*
+   * Function(s): set, reset, test
+   * Description: Sets, clears or checks the bit of one room.
+   * Parameters:
+   *    index (RoomIndex): The index of the room. Must be on the board.
+   */
+  void set(RoomIndex index);
+  void reset(RoomIndex index);
+  bool test(RoomIndex index) const;
+
+  /*
+   * Function: size
+   * Returns (int): The number of rooms on the board.
+   */
+  int size() const;
+
+  /*
+   * Function: find
+   * Description: Finds the room with the given rank among the rooms whose bit
+   *    has the given value, skipping whole words by their popcount.
+   * Parameters:
+   *    rank (int): The number of matching rooms to skip, counting from room 0.
+   *    value (bool): Whether to look for set or clear bits.
+   * Returns (RoomIndex): The index of the room, or NONE if there aren't more
+   *    than rank matching rooms.
+   */
+  RoomIndex find(int rank, bool value) const;
+};
+
+#endif
@@ -1,7 +1,5 @@
 #include "bottomlessPit.hpp"
 
-#include <random>
-
 
 BottomlessPit::BottomlessPit(Event* const defaultEvent) : Event(defaultEvent) {}
 
@@ -23,8 +21,7 @@ std::string BottomlessPit::getPercept(int) const {
 
 GameUpdate::pointer BottomlessPit::triggerUpdate(Trigger* const trigger) {
   if(trigger->player()) {
-    double p = (double)rand() / (double)RAND_MAX;
-    if(p < fallChance) {
+    if(random->chance(fallChance)) {
       return new GameUpdate(GameUpdate::LoseGame, "You slipped and fell "
           "into a pit! You still haven't found the bottom...\n"
           "\n...aaaahhhhhhhhh!!!!!!!");
@@ -1,7 +1,36 @@
 #include "cave.hpp"
 
-Cave::Cave() : gameMode(NONE) {}
+#include <stdexcept>
+
+Cave::Cave() : gameMode(NONE), viewRows(0), viewCols(0) {}
 
 void Cave::setGameMode(const int mode) {
   gameMode = mode;
 }
+
+void Cave::setViewSize(const int rows, const int cols) {
+  viewRows = rows;
+  viewCols = cols;
+}
+
+GameUpdate::pointer Cave::dispatchUpdate(const GameUpdate& update) {
+  const int type = update.getType();
+  if(type >= 0 && type < (int)updateHandlers.size() && updateHandlers[type]) {
+    return updateHandlers[type](update);
+  }
+  return nullptr;
+}
+
+Cave::UpdateHandler Cave::setUpdateHandler(const int type,
+    UpdateHandler handler) {
+  if(type < 0) {
+    throw std::invalid_argument("Update handlers can't be registered for "
+        "negative update types.");
+  }
+  if(type >= (int)updateHandlers.size()) {
+    updateHandlers.resize(type + 1);
+  }
+  UpdateHandler previous = std::move(updateHandlers[type]);
+  updateHandlers[type] = std::move(handler);
+  return previous;
+}
@@ -1,22 +1,63 @@
 #ifndef CAVE_HPP
 #define CAVE_HPP
 
+#include <functional>
+
 #include "room.hpp"
 #include "player.hpp"
 #include "gameSetup.hpp"
+#include "random.hpp"
 
 
 class Cave {
+public:
+  // Resolves one type of update, returning any updates it triggers
+  typedef std::function<GameUpdate::pointer(const GameUpdate&)> UpdateHandler;
+
 protected:
   int gameMode;
 
+  // The lines and columns of text the turn display should fit in, or 0 if
+  // it isn't limited
+  int viewRows;
+  int viewCols;
+
+  // Continues the sequence of the setup's generator. Mutable because
+  // displaying the board shuffles the percepts.
+  mutable Random random;
+
+  // Handlers indexed by update type. Types without a handler are empty.
+  std::vector<UpdateHandler> updateHandlers;
+
+  /*
+   * Function: dispatchUpdate
+   * Description: Looks up the handler registered for the type of the given
+   *    update and calls it.
+   * Parameters:
+   *    update (GameUpdate): The update to resolve.
+   * Returns (GameUpdate::pointer): The updates returned by the handler, or
+   *    nullptr if no handler is registered for the update type.
+   */
+  GameUpdate::pointer dispatchUpdate(const GameUpdate& update);
+
 public:
   /*
    * Function: Default Constructor
-   * Description: Initalizes gameMode to NONE.
+   * Description: Initalizes gameMode to NONE, with no limit on the view
+   *    size.
    */
   Cave();
 
+  /*
+   * Function(s): Copy/Move Constructor/Assignment
+   * Description: Registered update handlers may refer to the cave they were
+   *    registered with, so a Cave object can't be copied or moved.
+   */
+  Cave(const Cave&) = delete;
+  Cave(Cave&&) = delete;
+  Cave& operator=(const Cave&) = delete;
+  Cave& operator=(Cave&&) = delete;
+
   /*
    * Function: Destructor
    * Description: Doesn't explicitly delete anything, but should be marked
@@ -32,6 +73,32 @@ public:
    */
   void setGameMode(int mode);
 
+  /*
+   * Function: setViewSize
+   * Description: Sets the amount of text the turn display should fit in, such
+   *    as the size of the terminal. Caves larger than this may display only
+   *    the part of the board around the active player.
+   * Parameters:
+   *    rows (int): The number of lines, or 0 for no limit.
+   *    cols (int): The number of columns, or 0 for no limit.
+   */
+  void setViewSize(int rows, int cols);
+
+  /*
+   * Function: setUpdateHandler
+   * Description: Registers the function that resolves updates of the given
+   *    type, replacing any handler already registered for it. Mods may use
+   *    this to change how a base game update works, or to add update types
+   *    numbered from GameUpdate::FirstModUpdate.
+   * Parameters:
+   *    type (int): The update type to handle.
+   *    handler (UpdateHandler): The function to resolve the update with.
+   * Returns (UpdateHandler): The handler previously registered for the type,
+   *    which may be empty. Keeping it allows a new handler to call through
+   *    to the old one.
+   */
+  UpdateHandler setUpdateHandler(int type, UpdateHandler handler);
+
   /*
    * Function: turnDisplay
    * Description: Returns a string containing information to be displayed at
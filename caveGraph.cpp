@@ -0,0 +1,93 @@
+#include "caveGraph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+CaveGraph::CaveGraph() : offsets(1, 0) {}
+
+CaveGraph::CaveGraph(const int roomCount, const std::vector<Tunnel>& edges) :
+    offsets(roomCount + 1, 0), tunnels(edges.size() * 2) {
+  // Count the tunnels out of each room, then turn the counts into offsets
+  for(const Tunnel& edge : edges) {
+    if(edge.first < 0 || edge.first >= roomCount ||
+        edge.second < 0 || edge.second >= roomCount) {
+      throw std::out_of_range("The tunnel between rooms " +
+          std::to_string(edge.first) + " and " + std::to_string(edge.second) +
+          " leads outside the cave.");
+    }
+    offsets[edge.first + 1]++;
+    offsets[edge.second + 1]++;
+  }
+  for(int i = 0; i < roomCount; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  // Place both ends of each tunnel into their rooms' rows
+  std::vector<int> next(offsets.begin(), offsets.end() - 1);
+  for(const Tunnel& edge : edges) {
+    tunnels[next[edge.first]++] = edge.second;
+    tunnels[next[edge.second]++] = edge.first;
+  }
+  for(int i = 0; i < roomCount; ++i) {
+    std::sort(tunnels.begin() + offsets[i], tunnels.begin() + offsets[i + 1]);
+  }
+}
+
+CaveGraph CaveGraph::dodecahedron() {
+  // The tunnels of the original game, with its rooms numbered from 0
+  static const Tunnel edges[] = {
+    { 0, 1 }, { 0, 4 }, { 0, 7 }, { 1, 2 }, { 1, 9 }, { 2, 3 },
+    { 2, 11 }, { 3, 4 }, { 3, 13 }, { 4, 5 }, { 5, 6 }, { 5, 14 },
+    { 6, 7 }, { 6, 16 }, { 7, 8 }, { 8, 9 }, { 8, 17 }, { 9, 10 },
+    { 10, 11 }, { 10, 18 }, { 11, 12 }, { 12, 13 }, { 12, 19 }, { 13, 14 },
+    { 14, 15 }, { 15, 16 }, { 15, 19 }, { 16, 17 }, { 17, 18 }, { 18, 19 },
+  };
+  return CaveGraph(dodecahedronRooms,
+      std::vector<Tunnel>(std::begin(edges), std::end(edges)));
+}
+
+int CaveGraph::roomCount() const {
+  return (int)offsets.size() - 1;
+}
+
+int CaveGraph::tunnelCount(const RoomIndex room) const {
+  return offsets[room + 1] - offsets[room];
+}
+
+RoomIndex CaveGraph::tunnel(const RoomIndex room, const int slot) const {
+  if(slot < 0 || slot >= tunnelCount(room)) {
+    return room;
+  }
+  return tunnels[offsets[room] + slot];
+}
+
+int CaveGraph::continueTunnel(const RoomIndex from, const RoomIndex room,
+    const int slot) const {
+  // Count the tunnels that don't lead back, then take the one the slot picks
+  int options = 0;
+  for(const RoomIndex* t = begin(room); t != end(room); ++t) {
+    if(*t != from) {
+      options++;
+    }
+  }
+  if(options == 0 || slot < 0) {
+    return NONE;
+  }
+
+  int chosen = slot % options;
+  for(int i = 0; i < tunnelCount(room); ++i) {
+    if(tunnel(room, i) != from && chosen-- == 0) {
+      return i;
+    }
+  }
+  return NONE;
+}
+
+const RoomIndex* CaveGraph::begin(const RoomIndex room) const {
+  return tunnels.data() + offsets[room];
+}
+const RoomIndex* CaveGraph::end(const RoomIndex room) const {
+  return tunnels.data() + offsets[room + 1];
+}
@@ -0,0 +1,107 @@
+#ifndef CAVE_GRAPH_HPP
+#define CAVE_GRAPH_HPP
+
+#include <utility>
+#include <vector>
+
+#include "htwTypes.hpp"
+
+
+// The tunnels between the rooms of a cave that isn't a grid, stored as
+// compressed sparse rows: the tunnels out of each room are contiguous in one
+// array, so walking a room's neighbours touches a single run of memory.
+class CaveGraph {
+public:
+  // The number of rooms in the classic dodecahedron cave
+  static constexpr int dodecahedronRooms = 20;
+
+  typedef std::pair<RoomIndex, RoomIndex> Tunnel;
+
+private:
+  // The tunnels out of room i are tunnels[offsets[i]] to tunnels[offsets[i+1]]
+  std::vector<int> offsets;
+  std::vector<RoomIndex> tunnels;
+
+public:
+  /*
+   * Function: Default Constructor
+   * Description: Creates a graph with no rooms.
+   */
+  CaveGraph();
+
+  /*
+   * Function: Constructor
+   * Description: Builds the graph from a list of two-way tunnels. The tunnels
+   *    out of each room are sorted by the room they lead to.
+   * Parameters:
+   *    roomCount (int): The number of rooms in the cave.
+   *    edges (vector<Tunnel>): Each pair of rooms joined by a tunnel.
+   * Effects: Throws std::out_of_range if a tunnel leads outside the cave.
+   */
+  CaveGraph(int roomCount, const std::vector<Tunnel>& edges);
+
+  /*
+   * Function: dodecahedron
+   * Description: Builds the cave from the original Hunt the Wumpus, where
+   *    each of the 20 rooms is a vertex of a dodecahedron with 3 tunnels.
+   * Returns (CaveGraph): The dodecahedron cave.
+   */
+  static CaveGraph dodecahedron();
+
+  /*
+   * Function: roomCount
+   * Description: Returns the number of rooms in the graph.
+   * Returns (int): The number of rooms.
+   */
+  int roomCount() const;
+
+  /*
+   * Function: tunnelCount
+   * Description: Returns the number of tunnels leading out of a room.
+   * Parameters:
+   *    room (RoomIndex): The room to check. Must be in the graph.
+   * Returns (int): The number of tunnels out of the room.
+   */
+  int tunnelCount(RoomIndex room) const;
+
+  /*
+   * Function: tunnel
+   * Description: Returns the room a tunnel leads to.
+   * Parameters:
+   *    room (RoomIndex): The room the tunnel leads out of. Must be in the
+   *      graph.
+   *    slot (int): Which of the room's tunnels to follow.
+   * Returns (RoomIndex): The room the tunnel leads to, or the room itself if
+   *    it doesn't have a tunnel in that slot.
+   */
+  RoomIndex tunnel(RoomIndex room, int slot) const;
+
+  /*
+   * Function: continueTunnel
+   * Description: Chooses the tunnel for something flying through a room, such
+   *    as an arrow, to leave it by. The tunnel leading back to the room it
+   *    came from is skipped, so it never doubles back, and the slot it came in
+   *    by picks one of the others, so the same shot always takes the same
+   *    path.
+   * Parameters:
+   *    from (RoomIndex): The room it just left.
+   *    room (RoomIndex): The room it is in. Must be in the graph.
+   *    slot (int): The tunnel it took out of the last room.
+   * Returns (int): The tunnel to take out of the room, or NONE if the only
+   *    tunnels lead back.
+   */
+  int continueTunnel(RoomIndex from, RoomIndex room, int slot) const;
+
+  /*
+   * Function(s): begin/end
+   * Description: Return pointers to the first and one past the last tunnel
+   *    leading out of a room, for iterating over its neighbours.
+   * Parameters:
+   *    room (RoomIndex): The room to get the tunnels of. Must be in the graph.
+   * Returns (const RoomIndex*): The start or end of the room's tunnels.
+   */
+  const RoomIndex* begin(RoomIndex room) const;
+  const RoomIndex* end(RoomIndex room) const;
+};
+
+#endif
@@ -1,7 +1,7 @@
 #include "caveImpl.hpp"
 
+#include <algorithm>
 #include <stdexcept>
-#include <sstream>
 
 #include "arrowItem.hpp"
 #include "arrowTrigger.hpp"
@@ -9,134 +9,239 @@
 
 
 
+RoomIndex BasicCave::toIndex(const RoomPos& pos) const {
+  if(pos.row < 0 || pos.row >= height || pos.col < 0 || pos.col >= width) {
+    throw std::out_of_range("The position (" + std::to_string(pos.row) +
+        ", " + std::to_string(pos.col) + ") isn't in the cave.");
+  }
+  return pos.row * width + pos.col;
+}
+
+RoomPos BasicCave::toPos(const RoomIndex index) const {
+  return RoomPos(index / width, index % width);
+}
+
 Room& BasicCave::getRoom(const RoomPos& pos) {
-  return cave.at(pos.row).at(pos.col);
+  return getRoom(toIndex(pos));
 }
 const Room& BasicCave::getRoom(const RoomPos& pos) const {
-  return cave.at(pos.row).at(pos.col);
+  return getRoom(toIndex(pos));
 }
 
-RoomPos BasicCave::addDirection(const RoomPos& room,
-    const int direction) const {
-  RoomPos adjacent = room;
-  if(direction == UpDir && adjacent.row > 0) {
-    adjacent.row--;
-  } else if(direction == DownDir && adjacent.row < height - 1) {
-    adjacent.row++;
-  } else if(direction == LeftDir && adjacent.col > 0) {
-    adjacent.col--;
-  } else if(direction == RightDir && adjacent.col < width - 1) {
-    adjacent.col++;
+Room& BasicCave::getRoom(const RoomIndex index) {
+  return rooms[index];
+}
+const Room& BasicCave::getRoom(const RoomIndex index) const {
+  return rooms[index];
+}
+
+Room& BasicCave::occupyRoom(const RoomIndex index) {
+  return rooms[index];
+}
+
+// Removes the first copy of the item from the list without keeping its order
+template<typename T>
+static void removeUnordered(std::vector<T*>& list, T* const item) {
+  auto found = std::find(list.begin(), list.end(), item);
+  if(found != list.end()) {
+    *found = list.back();
+    list.pop_back();
   }
-  return adjacent;
 }
 
-RoomPos BasicCave::chooseRoom() {
-  int room = (int)(((double)rand() / RAND_MAX) * (height * width));
-  int count = 0;
-  for(int i = 0; i < height; ++i) {
-    for(int j = 0; j < width; ++j) {
-      if(cave.at(i).at(j).empty()) {
-        if(room == count) {
-          return RoomPos(i, j);
-        }
-        count++;
-      }
-    }
+void BasicCave::updateEmptyRoom(const RoomIndex index) {
+  const bool listed = notNone(emptyRoomSlots[index]);
+  const bool empty = rooms[index].empty();
+  if(empty && !listed) {
+    emptyRoomSlots[index] = (int)emptyRooms.size();
+    emptyRooms.push_back(index);
+
+  } else if(!empty && listed) {
+    // Move the last empty room into this room's slot
+    const int slot = emptyRoomSlots[index];
+    const RoomIndex last = emptyRooms.back();
+    emptyRooms[slot] = last;
+    emptyRoomSlots[last] = slot;
+    emptyRooms.pop_back();
+    emptyRoomSlots[index] = NONE;
   }
-  return RoomPos(0,0);
 }
 
-RoomPos BasicCave::chooseEmptyRoom() {
-  int emptyCount = 0;
-  for(int i = 0; i < height; ++i) {
-    for(int j = 0; j < width; ++j) {
-      if(cave.at(i).at(j).empty()) {
-        emptyCount++;
-      }
-    }
+void BasicCave::addEventToRoom(Event* const ev, const RoomPos& pos) {
+  const RoomIndex index = toIndex(pos);
+  occupyRoom(index).addEvent(ev);
+  updateEmptyRoom(index);
+  occupiedRooms.set(index);
+
+  eventsByName[ev->name()].push_back(ev);
+  if(ev->receivesTurnUpdates()) {
+    turnEvents.push_back(ev);
+  }
+}
+void BasicCave::removeEventFromRoom(Event* const ev, const RoomPos& pos) {
+  const RoomIndex index = toIndex(pos);
+  getRoom(index).removeEvent(ev);
+  updateEmptyRoom(index);
+  if(getRoom(index).empty()) {
+    occupiedRooms.reset(index);
   }
 
-  int room = (int)(((double)rand() / RAND_MAX) * emptyCount);
-  emptyCount = 0;
-  for(int i = 0; i < height; ++i) {
-    for(int j = 0; j < width; ++j) {
-      if(cave.at(i).at(j).empty()) {
-        if(room == emptyCount) {
-          return RoomPos(i, j);
-        }
-        emptyCount++;
-      }
-    }
+  auto named = eventsByName.find(ev->name());
+  if(named != eventsByName.end()) {
+    removeUnordered(named->second, ev);
   }
-  return RoomPos(0,0);
+  removeUnordered(turnEvents, ev);
 }
 
-int BasicCave::chooseDirection(const RoomPos& pos) {
-  int limitedDirection = NONE;
-  if(pos.row == 0) {
-    limitedDirection = UpDir;
-  } else if(pos.row == height - 1) {
-    limitedDirection = DownDir;
-  } else if(pos.col == 0) {
-    limitedDirection = LeftDir;
-  } else if(pos.col == width - 1) {
-    limitedDirection = RightDir;
+void BasicCave::addPlayerToRoom(Player* const pl, const RoomPos& pos) {
+  const RoomIndex index = toIndex(pos);
+  occupyRoom(index).addPlayer(pl);
+  updateEmptyRoom(index);
+  occupiedRooms.set(index);
+  if(pl->receivesTurnUpdates()) {
+    turnPlayers.push_back(pl);
   }
+}
+void BasicCave::removePlayerFromRoom(Player* const pl, const RoomPos& pos) {
+  const RoomIndex index = toIndex(pos);
+  getRoom(index).removePlayer(pl);
+  updateEmptyRoom(index);
+  if(getRoom(index).empty()) {
+    occupiedRooms.reset(index);
+  }
+  removeUnordered(turnPlayers, pl);
+}
 
-  int options = 4 - (int)notNone(limitedDirection);
-  int direction = (int)(((double)rand() / RAND_MAX) * options);
-  if(notNone(limitedDirection) && direction >= limitedDirection) {
-    direction++;
+int BasicCave::tunnelCount(const RoomIndex) const {
+  return RightDir + 1;
+}
+
+RoomIndex BasicCave::tunnel(const RoomIndex index, const int slot) const {
+  const int row = index / width;
+  const int col = index % width;
+  if(slot == UpDir && row > 0) {
+    return index - width;
+  } else if(slot == DownDir && row < height - 1) {
+    return index + width;
+  } else if(slot == LeftDir && col > 0) {
+    return index - 1;
+  } else if(slot == RightDir && col < width - 1) {
+    return index + 1;
+  }
+  return index;
+}
+
+int BasicCave::continueTunnel(const RoomIndex, const RoomIndex,
+    const int slot) const {
+  return slot;
+}
+
+RoomPos BasicCave::addDirection(const RoomPos& room,
+    const int direction) const {
+  return toPos(tunnel(toIndex(room), direction));
+}
+
+RoomPos BasicCave::chooseRoom() {
+  return toPos(random.index(height * width));
+}
+
+RoomPos BasicCave::chooseEmptyRoom() {
+  if(emptyRooms.empty()) {
+    return RoomPos(0,0);
   }
-  return direction;
+  return toPos(emptyRooms[random.index((int)emptyRooms.size())]);
+}
+
+int BasicCave::chooseDirection(const RoomPos& pos) {
+  return chooseTunnel(pos, false);
 }
 
 int BasicCave::chooseEmptyDirection(const RoomPos& pos) {
-  constexpr int numDirs = 4;
-
-  int limitedCount = 0;
-  std::vector<bool> limitedDirections(numDirs, false);
-  for(int i = 0; i < numDirs; ++i) {
-    RoomPos adjacent = addDirection(pos, i);
-    // If there isn't a room in the direction or it isn't empty
-    if(adjacent == pos || !getRoom(adjacent).empty()) {
-      limitedDirections[i] = true;
-      limitedCount++;
+  return chooseTunnel(pos, true);
+}
+
+int BasicCave::chooseTunnel(const RoomPos& pos, const bool onlyEmpty) {
+  const RoomIndex index = toIndex(pos);
+  const int count = tunnelCount(index);
+
+  // Count the tunnels that can be taken, then pick one of them
+  int options = 0;
+  for(int i = 0; i < count; ++i) {
+    RoomIndex adjacent = tunnel(index, i);
+    if(adjacent != index && (!onlyEmpty || !occupiedRooms.test(adjacent))) {
+      options++;
     }
   }
-
-  int options = numDirs - limitedCount;
   if(options == 0) {
     return NONE;
   }
-  int direction = (int)(((double)rand() / RAND_MAX) * options);
 
-  for(int i = 0; i < numDirs; ++i) {
-    if(limitedDirections[i] && direction >= i) {
-      direction++;
+  int chosen = random.index(options);
+  for(int i = 0; i < count; ++i) {
+    RoomIndex adjacent = tunnel(index, i);
+    if(adjacent != index && (!onlyEmpty || !occupiedRooms.test(adjacent)) &&
+        chosen-- == 0) {
+      return i;
     }
   }
-  return direction;
+  return NONE;
 }
 
 
 
-std::string BasicCave::joinLines(const std::string& left,
-    const std::string& right, int spacing) {
-  std::stringstream lss(left);
-  std::stringstream rss(right);
+// Counts the lines of the text, where a newline at the end doesn't start
+// another line
+static std::size_t countLines(const std::string_view text) {
+  std::size_t lines = (std::size_t)std::count(text.begin(), text.end(), '\n');
+  if(!text.empty() && text.back() != '\n') {
+    lines++;
+  }
+  return lines;
+}
+
+// Returns the line of the text starting at pos, without its newline, and moves
+// pos to the start of the next line. Past the end of the text, lines are empty.
+static std::string_view nextLine(const std::string_view text,
+    std::size_t& pos) {
+  if(pos >= text.size()) {
+    return std::string_view();
+  }
+  std::size_t end = text.find('\n', pos);
+  if(end == std::string_view::npos) {
+    end = text.size();
+  }
+  std::string_view line = text.substr(pos, end - pos);
+  pos = end + 1;
+  return line;
+}
+
+// Lines of the view kept below the board for the percepts and prompts
+static constexpr int viewTextRows = 8;
+// Columns between the board and the item list beside it
+static constexpr int panelSpacing = 4;
+
+// Writes a border between rows of the board, "-----...- ", and its newline to
+// the line of the given length
+static void writeRowBorder(char* const line, const std::size_t length) {
+  std::fill(line, line + length - 2, '-');
+  line[length - 2] = ' ';
+  line[length - 1] = '\n';
+}
 
+std::string BasicCave::joinLines(const std::string_view left,
+    const std::string_view right, const int spacing) {
+  // Size the result up front, so each line is copied straight into it
+  const std::size_t lines = std::max(countLines(left), countLines(right));
   std::string combined;
-  std::string lline;
-  std::string rline;
-  while(true) {
-    bool rresult = (bool)std::getline(lss, lline);
-    bool lresult = (bool)std::getline(rss, rline);
-    if(!rresult && !lresult) {
-      break;
-    }
-    combined += lline + std::string(spacing, ' ') + rline + '\n';
+  combined.reserve(left.size() + right.size() + lines * (spacing + 1));
+
+  std::size_t lpos = 0;
+  std::size_t rpos = 0;
+  for(std::size_t i = 0; i < lines; ++i) {
+    combined += nextLine(left, lpos);
+    combined.append(spacing, ' ');
+    combined += nextLine(right, rpos);
+    combined += '\n';
   }
   return combined;
 }
@@ -146,33 +251,8 @@ std::string BasicCave::getItemList(Player* player) const {
 }
 
 std::string BasicCave::getBoard() const {
-  std::string board;
-  std::string row_border = "-";
-  for (int i = 0; i < width; ++i) {
-    row_border += "----";
-  }
-  row_border += " ";
-
-  board += row_border + "\n";
-  for (int i = 0; i < height; ++i) {
-    board += "| ";
-    for (int j = 0; j < width; ++j) {
-      // Get the character representing the room if there is one
-      char c = cave.at(i).at(j).getChar(gameMode);
-
-      // If none of the calls have yielded a character result, insert a space.
-      if(c == (char)NONE) {
-        c = ' ';
-      }
-      board += c;
+  return getBoardWindow(0, 0, height, width);
 
-      board += " | ";
-    }
-    board += "\n";
-    board += row_border + "\n";
-  }
-  return board;
-  
   //example output (when finished): 
   // -----------------
   // | P | G | P |   |
@@ -185,17 +265,84 @@ std::string BasicCave::getBoard() const {
   // -----------------
 }
 
+std::string BasicCave::getBoardWindow(const int top, const int left,
+    const int rows, const int cols) const {
+  // Borders and rows of rooms both take 4 characters a room plus 3, so the
+  // whole board can be allocated at once and each room written in place
+  const std::size_t lineLength = (std::size_t)cols * 4 + 3;
+  std::string board((2 * (std::size_t)rows + 1) * lineLength, ' ');
+  char* line = &board[0];
+
+  writeRowBorder(line, lineLength);
+  line += lineLength;
+  for (int i = 0; i < rows; ++i) {
+    RoomIndex index = (RoomIndex)(top + i) * width + left;
+    line[0] = '|';
+    for (int j = 0; j < cols; ++j, ++index) {
+      // Get the character representing the room if there is one
+      char c = getRoom(index).getChar(gameMode);
+
+      // If none of the calls have yielded a character result, leave a space.
+      if(c != (char)NONE) {
+        line[j * 4 + 2] = c;
+      }
+      line[j * 4 + 4] = '|';
+    }
+    line[lineLength - 1] = '\n';
+    line += lineLength;
+
+    writeRowBorder(line, lineLength);
+    line += lineLength;
+  }
+  return board;
+}
+
+std::string BasicCave::getBoardView(Player* const active,
+    const int panelWidth) {
+  if(viewRows <= 0 || viewCols <= 0) {
+    return getBoard();
+  }
+
+  // Lines as wide as the screen would wrap, and the percepts and prompts
+  // need lines below the board. The spacing is added to each line even when
+  // the item list is empty.
+  const int textRows = viewRows - viewTextRows;
+  const int textCols = viewCols - 1 - panelSpacing - panelWidth;
+  if(2 * height + 1 <= textRows && 4 * width + 3 <= textCols) {
+    return getBoard();
+  }
+
+  if(active) {
+    viewCentre = active->getLocation();
+  }
+  // Each room takes 2 lines and 4 columns, and one line says which rooms
+  // are shown
+  const int rows = std::clamp((textRows - 2) / 2, 1, height);
+  const int cols = std::clamp((textCols - 3) / 4, 1, width);
+  const int top = std::clamp(viewCentre.row - rows / 2, 0, height - rows);
+  const int left = std::clamp(viewCentre.col - cols / 2, 0, width - cols);
+
+  std::string board = getBoardWindow(top, left, rows, cols);
+  board += "Rows " + std::to_string(top + 1) + "-" +
+      std::to_string(top + rows) + " of " + std::to_string(height) +
+      ", columns " + std::to_string(left + 1) + "-" +
+      std::to_string(left + cols) + " of " + std::to_string(width) + "\n";
+  return board;
+}
+
 std::string BasicCave::getPercepts(Player* const player) const {
   std::string percepts;
-  RoomPos room = player->getLocation();
+  const RoomIndex room = toIndex(player->getLocation());
 
-  // For each direction
-  for(int i = 0; i < 4; ++i) {
-    RoomPos adjacent = addDirection(room, i);
+  // For each tunnel out of the room
+  const int count = tunnelCount(room);
+  for(int i = 0; i < count; ++i) {
+    RoomIndex adjacent = tunnel(room, i);
     if(adjacent != room) {
-      std::string p = getRoom(adjacent).getPercepts(gameMode);
+      std::string p = getRoom(adjacent).getPercepts(gameMode, random);
       if(!p.empty()) {
-        percepts += p + "\n";
+        percepts += p;
+        percepts += '\n';
       }
     }
   }
@@ -347,11 +494,12 @@ GameUpdate::pointer BasicCave::handlePlayerInput(const GameUpdate& update) {
 void BasicCave::createObject(const GameUpdate& update) {
   if(update.hasPlayer()) {
     Player* pl = update.getPlayer();
-    getRoom(pl->getLocation()).addPlayer(pl);
+    addPlayerToRoom(pl, pl->getLocation());
 
   } else if(update.hasEvent()) {
     Event* ev = update.getEvent();
-    getRoom(ev->getLocation()).addEvent(ev);
+    ev->setRandom(&random);
+    addEventToRoom(ev, ev->getLocation());
 
   } else {
     throw std::runtime_error("CreateObject call doesn't have an event "
@@ -403,8 +551,8 @@ GameUpdate::pointer BasicCave::movePlayer(const GameUpdate& update) {
   }
   pl->setLocation(moveTo);
 
-  getRoom(from).removePlayer(pl);
-  getRoom(moveTo).addPlayer(pl);
+  removePlayerFromRoom(pl, from);
+  addPlayerToRoom(pl, moveTo);
   
   GameUpdate::pointer triggered = nullptr;
   if(pl->getEnabled() && from != moveTo) {
@@ -440,8 +588,8 @@ GameUpdate::pointer BasicCave::moveEvent(const GameUpdate& update) {
   }
   ev->setLocation(moveTo);
 
-  getRoom(from).removeEvent(ev);
-  getRoom(moveTo).addEvent(ev);
+  removeEventFromRoom(ev, from);
+  addEventToRoom(ev, moveTo);
 
   return nullptr;
 }
@@ -457,13 +605,18 @@ GameUpdate::pointer BasicCave::moveTrigger(const GameUpdate& update) {
   } else {
     moveTo = update.getRoom();
     if(moveTo.empty()) {
-      int direction;
       if(notNone(update.getInfo())) {
-        direction = update.getInfo();
+        moveTo = addDirection(tg->getLocation(), update.getInfo());
       } else {
-        direction = tg->getDirection();
+        // Keep flying on the trigger's own direction, which has to be turned
+        // into the matching tunnel out of the new room
+        int direction = tg->getDirection();
+        moveTo = addDirection(tg->getLocation(), direction);
+        if(from != moveTo) {
+          tg->setDirection(continueTunnel(toIndex(from), toIndex(moveTo),
+              direction));
+        }
       }
-      moveTo = addDirection(tg->getLocation(), direction);
     }
   }
   tg->setLocation(moveTo);
@@ -495,14 +648,14 @@ GameUpdate::pointer BasicCave::moveObject(const GameUpdate& update) {
 void BasicCave::destroyObject(const GameUpdate& update) {
   if(update.getPlayer()) {
     Player* pl = update.getPlayer();
-    getRoom(pl->getLocation()).removePlayer(pl);
+    removePlayerFromRoom(pl, pl->getLocation());
     if(update.hasPlayer()) {
       delete pl;
     }
 
   } else if(update.getEvent()) {
     Event* ev = update.getEvent();
-    getRoom(ev->getLocation()).removeEvent(ev);
+    removeEventFromRoom(ev, ev->getLocation());
     if(update.hasEvent()) {
       delete ev;
     }
@@ -567,48 +720,176 @@ GameUpdate::pointer BasicCave::evaluateItemConditional(
 
 GameUpdate::pointer BasicCave::triggerEventWithName(const GameUpdate& update) {
   GameUpdate::pointer addUpdate = nullptr;
-  std::string name = update.getMessage();
-  for(int i = 0; i < height; ++i) {
-    for(int j = 0; j < width; ++j) {
-      Event* ev = cave.at(i).at(j).getEvent(name);
-      if(ev) {
-        addUpdate.append(ev->triggerUpdate(update.getTrigger()));
-      }
+  std::string name(update.getMessage());
+
+  // The shared default event is the first event in every room
+  if(defaultEvent->name() == name) {
+    for(RoomIndex i = 0; i < height * width; ++i) {
+      addUpdate.append(defaultEvent->triggerUpdate(update.getTrigger()));
     }
+    return addUpdate;
+  }
+
+  auto named = eventsByName.find(name);
+  if(named == eventsByName.end() || named->second.empty()) {
+    return addUpdate;
+  }
+  if(named->second.size() == 1) {
+    return named->second.front()->triggerUpdate(update.getTrigger());
+  }
+
+  // Only the first matching event in each room is triggered, in the order a
+  // sweep of the board would find them
+  std::vector<RoomIndex> matched;
+  matched.reserve(named->second.size());
+  for(Event* ev : named->second) {
+    matched.push_back(toIndex(ev->getLocation()));
+  }
+  std::sort(matched.begin(), matched.end());
+  matched.erase(std::unique(matched.begin(), matched.end()), matched.end());
+
+  for(RoomIndex index : matched) {
+    Event* ev = getRoom(index).getEvent(name);
+    addUpdate.append(ev->triggerUpdate(update.getTrigger()));
   }
   return addUpdate;
 }
 
 
+void BasicCave::registerUpdateHandlers() {
+  setUpdateHandler(GameUpdate::HandlePlayerInput,
+      [this](const GameUpdate& update) {
+    return handlePlayerInput(update);
+  });
+  setUpdateHandler(GameUpdate::PromptTurnAction,
+      [this](const GameUpdate& update) {
+    return turnPrompt(update.getPlayer());
+  });
+  setUpdateHandler(GameUpdate::SetPlayerActionEnabled,
+      [this](const GameUpdate& update) {
+    playerActionEnabled = (update.getInfo() >= 1);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::CreateObject,
+      [this](const GameUpdate& update) {
+    createObject(update);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::MoveObject,
+      [this](const GameUpdate& update) {
+    return moveObject(update);
+  });
+  setUpdateHandler(GameUpdate::MoveObjectRandom,
+      [this](const GameUpdate& update) {
+    return moveObject(update);
+  });
+  setUpdateHandler(GameUpdate::DestroyObject,
+      [this](const GameUpdate& update) {
+    destroyObject(update);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::PickupItem,
+      [this](const GameUpdate& update) {
+    pickupItem(update);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::RemoveItem,
+      [this](const GameUpdate& update) {
+    removeItem(update);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::ItemConditional,
+      [this](const GameUpdate& update) {
+    return evaluateItemConditional(update);
+  });
+  setUpdateHandler(GameUpdate::ItemConditionalExact,
+      [this](const GameUpdate& update) {
+    return evaluateItemConditional(update);
+  });
+  setUpdateHandler(GameUpdate::SetObjectEnabled,
+      [](const GameUpdate& update) {
+    update.getTrigger()->setEnabled(update.getInfo() >= 1);
+    return GameUpdate::pointer();
+  });
+  setUpdateHandler(GameUpdate::TriggerEvent,
+      [this](const GameUpdate& update) {
+    return triggerEventWithName(update);
+  });
+}
+
+
+
+BasicCave::BasicCave(const GameSetup* const setup) : BasicCave(setup, true) {
+  addSetupEvents(setup);
+}
 
-BasicCave::BasicCave(const GameSetup* const setup) : Cave() {
+BasicCave::BasicCave(const GameSetup* const setup, const bool allocateRooms) :
+    Cave() {
   height = setup->getSetupVar(GameSetup::Height);
   width = setup->getSetupVar(GameSetup::Width);
-
-  cave.resize(height, std::vector<Room>(width));
-  for (int i = 0; i < height; ++i) {
-    for (int j = 0; j < width; ++j) {
-      cave.at(i).at(j).setLocation({i, j});
-      cave.at(i).at(j).addEvent(setup->getDefaultEvent());
+  topology = setup->getSetupVar(GameSetup::Topology);
+  random = setup->getRandom();
+
+  defaultEvent = setup->getDefaultEvent();
+  defaultEvent->setRandom(&random);
+  occupiedRooms = Bitboard(height, width);
+
+  if(allocateRooms) {
+    rooms.resize(height * width);
+    emptyRoomSlots.assign(rooms.size(), NONE);
+    for(RoomIndex i = 0; i < (RoomIndex)rooms.size(); ++i) {
+      rooms[i].setLocation(toPos(i));
+      rooms[i].setDefaultEvent(defaultEvent);
+      updateEmptyRoom(i);
     }
   }
 
+  viewCentre = RoomPos(height / 2, width / 2);
+  registerUpdateHandlers();
+}
+
+void BasicCave::addSetupEvents(const GameSetup* const setup) {
   for(Event* ev : setup->getEvents()) {
     RoomPos pos = ev->getLocation();
-    getRoom(pos).addEvent(ev);
+    ev->setRandom(&random);
+    addEventToRoom(ev, pos);
   }
 }
 
+BasicCave::~BasicCave() {
+  delete defaultEvent;
+}
+
+
 
+CaveSnapshot BasicCave::getSnapshot() const {
+  CaveSnapshot snapshot(height, width, topology);
+  for(RoomIndex i = 0; i < height * width; ++i) {
+    const Room& room = getRoom(i);
+    for(Event* ev : room.getEvents()) {
+      snapshot.addEvent(ev->name(), i);
+    }
+    for(std::size_t j = 0; j < room.getPlayers().size(); ++j) {
+      snapshot.addSpawn(i);
+    }
+  }
+  return snapshot;
+}
 
 std::string BasicCave::turnDisplay(Player* const active) {
+  // The item list starts on the board's second line
   std::string items;
+  int panelWidth = 0;
   if(active) {
-    items = "\n" + getItemList(active);
+    items = '\n';
+    items += getItemList(active);
+    std::size_t pos = 0;
+    while(pos < items.size()) {
+      panelWidth = std::max(panelWidth, (int)nextLine(items, pos).size());
+    }
   }
-  std::string board = getBoard();
-
-  std::string output = joinLines(board, items, 4);
+  std::string output = joinLines(getBoardView(active, panelWidth), items,
+      panelSpacing);
   if(active) {
     output += getPercepts(active);
   }
@@ -620,51 +901,37 @@ GameUpdate::pointer BasicCave::getTurnUpdate(Player* const active,
   playerActionEnabled = true;
 
   GameUpdate::pointer update;
-  for(int i = 0; i < height; ++i) {
-    for(int j = 0; j < width; ++j) {
-      GameUpdate::pointer p = cave.at(i).at(j).triggerTurnUpdate(active, round);
-      update.append(p);
+  // A subscribed default event is in every room, so visit them all
+  if(defaultEvent->receivesTurnUpdates()) {
+    for(RoomIndex i = 0; i < height * width; ++i) {
+      update.append(getRoom(i).triggerTurnUpdate(active, round));
     }
+    return update;
   }
-  return update;
-}
-
-GameUpdate::pointer BasicCave::updateState(const GameUpdate& update) {
-  GameUpdate::pointer addUpdate = nullptr;
-  if(update == GameUpdate::HandlePlayerInput) {
-    addUpdate = handlePlayerInput(update);
-  }
-  if(update == GameUpdate::PromptTurnAction) {
-    addUpdate = turnPrompt(update.getPlayer());
-  }
-  else if(update == GameUpdate::SetPlayerActionEnabled) {
-    playerActionEnabled = (update.getInfo() >= 1);
-  }
-  else if(update == GameUpdate::CreateObject) {
-    createObject(update);
-  }
-  else if(update == GameUpdate::MoveObject ||
-      update == GameUpdate::MoveObjectRandom) {
-    addUpdate = moveObject(update);
-  }
-  else if(update == GameUpdate::DestroyObject) {
-    destroyObject(update);
-  }
-  else if(update == GameUpdate::PickupItem) {
-    pickupItem(update);
-  }
-  else if(update == GameUpdate::RemoveItem) {
-    removeItem(update);
+  if(turnPlayers.empty() && turnEvents.empty()) {
+    return update;
   }
-  else if(update == GameUpdate::ItemConditional ||
-      update == GameUpdate::ItemConditionalExact) {
-    addUpdate = evaluateItemConditional(update);
+
+  // Visit the rooms in the order a sweep of the board would
+  std::vector<RoomIndex> subscribed;
+  subscribed.reserve(turnPlayers.size() + turnEvents.size());
+  for(Player* pl : turnPlayers) {
+    subscribed.push_back(toIndex(pl->getLocation()));
   }
-  else if(update == GameUpdate::SetObjectEnabled) {
-    update.getTrigger()->setEnabled(update.getInfo() >= 1);
+  for(Event* ev : turnEvents) {
+    subscribed.push_back(toIndex(ev->getLocation()));
   }
-  else if(update == GameUpdate::TriggerEvent) {
-    addUpdate = triggerEventWithName(update);
+  std::sort(subscribed.begin(), subscribed.end());
+  subscribed.erase(std::unique(subscribed.begin(), subscribed.end()),
+      subscribed.end());
+
+  for(RoomIndex index : subscribed) {
+    GameUpdate::pointer p = getRoom(index).triggerTurnUpdate(active, round);
+    update.append(p);
   }
-  return addUpdate;
+  return update;
+}
+
+GameUpdate::pointer BasicCave::updateState(const GameUpdate& update) {
+  return dispatchUpdate(update);
 }
@@ -1,38 +1,183 @@
 #ifndef CAVE_BASIC_IMPL_HPP
 #define CAVE_BASIC_IMPL_HPP
 
+#include <string_view>
+#include <unordered_map>
+
+#include "bitboard.hpp"
 #include "cave.hpp"
+#include "caveSnapshot.hpp"
 
 
 class BasicCave : public Cave {
 protected:
   int height;
   int width;
-  std::vector<std::vector<Room>> cave;
+  // A value of CaveTopologies, from the setup
+  int topology;
+  // Every room on the board in row-major order, indexed by RoomIndex, unless
+  // a derived cave stores its rooms itself. Add and remove objects with the
+  // functions below (addEventToRoom etc.) so the indexes of the rooms stay up
+  // to date.
+  std::vector<Room> rooms;
+  // The default event shared by every room, owned by the cave
+  Event* defaultEvent;
+
+  // The index of every empty room, in no particular order
+  std::vector<RoomIndex> emptyRooms;
+  // The position of each room in emptyRooms, or NONE if it isn't empty
+  std::vector<int> emptyRoomSlots;
+
+  // Every event in the cave, grouped by the event's name
+  std::unordered_map<std::string, std::vector<Event*>> eventsByName;
+
+  // The rooms holding a player or an event other than the default event
+  Bitboard occupiedRooms;
+
+  // The players and events that receive turn updates, in no particular order
+  std::vector<Player*> turnPlayers;
+  std::vector<Event*> turnEvents;
   
   // Determines whether the playing player will be prompted for an action
   bool playerActionEnabled;
 
+  // The room the board is centred on when it is too large for the view size,
+  // which follows the active player
+  RoomPos viewCentre;
+
+
+  /*
+   * Function: toIndex
+   * Description: Converts a position on the board to the index of its room.
+   * Parameters:
+   *    pos (RoomPos): The position to convert.
+   * Returns (RoomIndex): The index of the room at the position.
+   * Effects: Throws std::out_of_range if the position isn't on the board.
+   */
+  RoomIndex toIndex(const RoomPos& pos) const;
+
+  /*
+   * Function: toPos
+   * Description: Converts the index of a room to its position on the board.
+   * Parameters:
+   *    index (RoomIndex): The index to convert. Must be a valid index.
+   * Returns (RoomPos): The position of the room.
+   */
+  RoomPos toPos(RoomIndex index) const;
 
   /*
    * Function: getRoom
-   * Description: Returns the room in the cave at RoomPos.
+   * Description: Returns the room in the cave at RoomPos. The position is
+   *    checked once, then the room is looked up without further checks.
    * Parameters:
    *    pos (RoomPos): The position to get the room at.
    * Returns (Room&): A reference to the room at the given position.
+   * Effects: Throws std::out_of_range if the position isn't on the board.
    */
   Room& getRoom(const RoomPos& pos);
   const Room& getRoom(const RoomPos& pos) const;
+
+  /*
+   * Function: getRoom(RoomIndex)
+   * Description: Returns the room with the given index without checking it.
+   *    Derived caves that store rooms differently override this, along with
+   *    occupyRoom, updateEmptyRoom and chooseEmptyRoom.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   * Returns (Room&): A reference to the room with the given index.
+   */
+  virtual Room& getRoom(RoomIndex index);
+  virtual const Room& getRoom(RoomIndex index) const;
+
+  /*
+   * Function: occupyRoom
+   * Description: Returns the room with the given index so an object can be
+   *    added to it. Unlike getRoom, a derived cave may create the room here.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   * Returns (Room&): A reference to the room with the given index.
+   */
+  virtual Room& occupyRoom(RoomIndex index);
+
+  /*
+   * Function: updateEmptyRoom
+   * Description: Adds the room to or removes it from the list of empty rooms
+   *    if whether it is empty has changed.
+   * Parameters:
+   *    index (RoomIndex): The index of the room that changed.
+   */
+  virtual void updateEmptyRoom(RoomIndex index);
+
+  /*
+   * Function: addSetupEvents
+   * Description: Adds each event from the setup to the cave. Called by the
+   *    constructor of the most derived cave, once its rooms are ready.
+   * Parameters:
+   *    setup (GameSetup*): The setup holding the placed events.
+   */
+  void addSetupEvents(const GameSetup* setup);
+
+  /*
+   * Function(s): Add/Remove [object] To/From Room
+   * Description: Adds an object to or removes it from the room at the given
+   *    position, and updates the indexes of the rooms to match. Removing an
+   *    object doesn't delete it.
+   * Parameters:
+   *    object (Event* or Player*): The object to add or remove.
+   *    pos (RoomPos): The position of the room.
+   */
+  void addEventToRoom(Event* ev, const RoomPos& pos);
+  void removeEventFromRoom(Event* ev, const RoomPos& pos);
+  void addPlayerToRoom(Player* pl, const RoomPos& pos);
+  void removePlayerFromRoom(Player* pl, const RoomPos& pos);
   
+  /*
+   * Function: tunnelCount
+   * Description: Returns the number of tunnels out of a room. Movement,
+   *    percepts and random directions all follow tunnels, so a cave with a
+   *    different layout only needs to override this and tunnel. On the grid
+   *    every room has one tunnel per direction in the Actions enum.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   * Returns (int): The number of tunnels out of the room.
+   */
+  virtual int tunnelCount(RoomIndex index) const;
+
+  /*
+   * Function: tunnel
+   * Description: Returns the room a tunnel out of the given room leads to. On
+   *    the grid the tunnel number is the direction to move in.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   *    slot (int): The number of the tunnel to follow.
+   * Returns (RoomIndex): The room the tunnel leads to, or the room itself if
+   *    there is no tunnel there (such as off the edge of the board).
+   */
+  virtual RoomIndex tunnel(RoomIndex index, int slot) const;
+
+  /*
+   * Function: continueTunnel
+   * Description: Returns the tunnel a trigger flying on its own direction,
+   *    such as an arrow, takes out of the room it just entered. On the grid it
+   *    carries on in a straight line, in the same direction.
+   * Parameters:
+   *    from (RoomIndex): The room the trigger just left.
+   *    index (RoomIndex): The room the trigger is in.
+   *    slot (int): The tunnel the trigger took out of the last room.
+   * Returns (int): The tunnel to take next, or NONE if it can't go on.
+   */
+  virtual int continueTunnel(RoomIndex from, RoomIndex index, int slot) const;
+
   /*
    * Function: addDirection
    * Description: Returns the room adjacent to the given room in the given
-   *    direction.
+   *    direction, by following the tunnel with that number.
    * Parameters:
    *    room (RoomPos): The original room.
    *    direction (int): The direction corresponding to the Direction enum
-   *      to move in.
-   * Returns (RoomPos): The adjacent room.
+   *      to move in, or the number of the tunnel to follow.
+   * Returns (RoomPos): The adjacent room, or the original room if there is
+   *    no tunnel in that direction.
    */
   RoomPos addDirection(const RoomPos& room, int direction) const;
 
@@ -47,18 +192,19 @@ protected:
   /*
    * Function: chooseEmptyRoom
    * Description: Randomly chooses an empty room in the cave and returns its
-   *    position.
+   *    position, in constant time using the list of empty rooms.
    * Returns (RoomPos): The position of the randomly chosen room.
    */
-  RoomPos chooseEmptyRoom();
+  virtual RoomPos chooseEmptyRoom();
   
   /*
    * Function: chooseDirection
    * Description: Randomly chooses a direction that the object at the given
-   *    location could move in.
+   *    location could move in, out of the tunnels leading to another room.
    * Parameters:
    *    pos (RoomPos): The location of the object.
-   * Returns (int): A number corresponding to the randomly chosen direction.
+   * Returns (int): A number corresponding to the randomly chosen direction,
+   *    or NONE if the room has no tunnels.
    */
   int chooseDirection(const RoomPos& pos);
 
@@ -69,23 +215,37 @@ protected:
    *    empty.
    * Parameters:
    *    pos (RoomPos): The location of the object.
-   * Returns (int): A number corresponding to the randomly chosen direction.
+   * Returns (int): A number corresponding to the randomly chosen direction,
+   *    or NONE if no adjacent room is empty.
    */
   int chooseEmptyDirection(const RoomPos& pos);
 
+  /*
+   * Function: chooseTunnel
+   * Description: Randomly chooses one of the tunnels out of a room that lead
+   *    to another room, optionally only those leading to an empty room.
+   * Parameters:
+   *    pos (RoomPos): The room to choose a tunnel out of.
+   *    onlyEmpty (bool): Whether the tunnel must lead to an empty room.
+   * Returns (int): The number of the chosen tunnel, or NONE if there are none
+   *    to choose from.
+   */
+  int chooseTunnel(const RoomPos& pos, bool onlyEmpty);
+
 
   /*
    * Function: joinLines
    * Description: Takes two strings and combines each of their lines (newline
-   *    character separated), separated by the given number of spaces.
+   *    character separated), separated by the given number of spaces. The
+   *    result is allocated once, at its final size.
    * Parameters:
-   *    left (string): The lines to place on the left side.
-   *    right (string): The lines to place on the right side.
+   *    left (string_view): The lines to place on the left side.
+   *    right (string_view): The lines to place on the right side.
    *    spacing (int): The number of spaces to add between each side.
    * Returns (string): The combination of the lines from the left and right
    *    sides.
    */
-  std::string joinLines(const std::string& left, const std::string& right,
+  std::string joinLines(std::string_view left, std::string_view right,
       int spacing);
 
   /* 
@@ -100,13 +260,39 @@ protected:
   /*
    * Function: getBoard
    * Description: Returns a string that will be printed to the console that
-   *    displays the board.
-   * Parameters:
-   *    players (vector<Player*>): The players in the game to display on
-   *      the board.
+   *    displays the board. The size of the board's text is known from its
+   *    size, so it is allocated once and each room written in place.
    * Returns (string): A textual representing the board.
    */
-  std::string getBoard() const;
+  virtual std::string getBoard() const;
+
+  /*
+   * Function: getBoardWindow
+   * Description: Returns the part of the board covering the given rooms, drawn
+   *    as getBoard draws the whole board. Only the rooms in the window are
+   *    visited.
+   * Parameters:
+   *    top (int): The first row of rooms to draw.
+   *    left (int): The first column of rooms to draw.
+   *    rows (int): The number of rows of rooms to draw.
+   *    cols (int): The number of columns of rooms to draw.
+   * Returns (string): A textual representation of the rooms.
+   */
+  std::string getBoardWindow(int top, int left, int rows, int cols) const;
+
+  /*
+   * Function: getBoardView
+   * Description: Returns the board if it fits in the view size beside the
+   *    item list. Otherwise returns the window of rooms that fits, centred on
+   *    the active player but kept inside the cave, with a line below it saying
+   *    which rooms are shown.
+   * Parameters:
+   *    active (Player*): The player to centre the window on, or nullptr to
+   *      keep the last centre.
+   *    panelWidth (int): The width of the item list beside the board.
+   * Returns (string): A textual representation of the board.
+   */
+  virtual std::string getBoardView(Player* active, int panelWidth);
 
   /*
    * Function: getPercepts
@@ -309,9 +495,10 @@ protected:
   GameUpdate::pointer evaluateItemConditional(const GameUpdate& update);
 
   /*
-   * Function: triggerEventWithEvent
-   * Description: Searches the cave for events with the given week, and
-   *    triggers each it finds with the given trigger.
+   * Function: triggerEventWithName
+   * Description: Looks up the events with the given name, and triggers the
+   *    first in each room they are in with the given trigger. Rooms are
+   *    triggered in row-major order.
    * Parameters:
    *    update (GameUpdate): Contains the name of the event to search for and
    *      the trigger to trigger the event with.
@@ -319,6 +506,13 @@ protected:
    */
   GameUpdate::pointer triggerEventWithName(const GameUpdate& update);
 
+  /*
+   * Function: registerUpdateHandlers
+   * Description: Registers the functions above as the handlers for each of
+   *    the update types resolved by the cave.
+   */
+  void registerUpdateHandlers();
+
 public:
   /*
    * Function: Constructor
@@ -330,6 +524,36 @@ public:
    */
   BasicCave(const GameSetup* setup);
 
+protected:
+  /*
+   * Function: Constructor(GameSetup*, bool)
+   * Description: Sets up everything but the events, so a derived cave can
+   *    prepare its own room storage before calling addSetupEvents.
+   * Parameters:
+   *    setup (GameSetup*): Contains the setup variables to use.
+   *    allocateRooms (bool): Whether to create every room up front.
+   */
+  BasicCave(const GameSetup* setup, bool allocateRooms);
+
+public:
+
+  /*
+   * Function: Destructor
+   * Description: Deletes the shared default event. The rooms delete their own
+   *    events.
+   */
+  ~BasicCave() override;
+
+  /*
+   * Function: getSnapshot
+   * Description: Records the size of the cave, the events in each room and the
+   *    rooms the players are in, visiting the rooms in row-major order. Taken
+   *    once the game has added its players, the players' rooms become the
+   *    snapshot's spawns.
+   * Returns (CaveSnapshot): The snapshot of the cave.
+   */
+  CaveSnapshot getSnapshot() const;
+
   /*
    * Function: turnDisplay
    * Description: Returns a string containing information to be displayed at
@@ -344,7 +568,8 @@ public:
   /*
    * Function: getTurnUpdate
    * Description: Returns a list of updates triggered by the start of the turn,
-   *    by calling the turnUpdate function for each event in the cave.
+   *    by calling the turnUpdate function for each player and event that
+   *    receives turn updates. Rooms are visited in row-major order.
    * Parameters:
    *    active (Player*): The player whose turn it is.
    *    round (bool): True if it's the first turn of a new round, and false
@@ -357,8 +582,9 @@ public:
   /*
    * Function: updateState
    * Description: Executes the given update by changing the board state
-   *    according to the instructions it contains. Returns any updates
-   *    triggered by these changes.
+   *    according to the instructions it contains, using the handler
+   *    registered for its type. Returns any updates triggered by these
+   *    changes.
    * Parameters:
    *    update (GameUpdate): Contains information about how to change the
    *      board state.
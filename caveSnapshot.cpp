@@ -0,0 +1,367 @@
+#include "caveSnapshot.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "arrowEvent.hpp"
+#include "batSwarm.hpp"
+#include "bottomlessPit.hpp"
+#include "escapeRope.hpp"
+#include "goldEvent.hpp"
+#include "wumpus.hpp"
+
+#ifdef __linux__
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+
+
+// A read-only view of a whole file, mapped into memory where the operating
+// system supports it and read into a buffer otherwise
+class MappedFile {
+private:
+  const unsigned char* data;
+  std::size_t length;
+#ifdef __linux__
+  void* mapping;
+#else
+  std::vector<char> buffer;
+#endif
+
+public:
+  MappedFile(const std::string& path) : data(nullptr), length(0) {
+#ifdef __linux__
+    mapping = MAP_FAILED;
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0) {
+      throw std::runtime_error("Couldn't open the cave file: " + path);
+    }
+    struct stat info;
+    if(fstat(fd, &info) == 0 && info.st_size > 0) {
+      length = (std::size_t)info.st_size;
+      mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if(mapping == MAP_FAILED) {
+      throw std::runtime_error("Couldn't map the cave file: " + path);
+    }
+    data = (const unsigned char*)mapping;
+#else
+    std::ifstream in(path, std::ios::binary);
+    if(!in) {
+      throw std::runtime_error("Couldn't open the cave file: " + path);
+    }
+    buffer.assign(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+    data = (const unsigned char*)buffer.data();
+    length = buffer.size();
+#endif
+  }
+
+  ~MappedFile() {
+#ifdef __linux__
+    munmap(mapping, length);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const unsigned char* begin() const {
+    return data;
+  }
+  std::size_t size() const {
+    return length;
+  }
+};
+
+// Reads the numbers written by CaveSnapshot from a buffer, throwing if the
+// buffer ends partway through
+class SnapshotReader {
+private:
+  const unsigned char* data;
+  std::size_t size;
+  std::size_t pos;
+
+public:
+  SnapshotReader(const unsigned char* data, std::size_t size,
+      std::size_t pos) : data(data), size(size), pos(pos) {}
+
+  bool done() const {
+    return pos == size;
+  }
+
+  // Checks that the given number of 32-bit numbers are left to read
+  void require(std::uint64_t count) {
+    if(count > (size - pos) / 4) {
+      throw std::runtime_error("The cave file ends too early.");
+    }
+  }
+
+  std::uint32_t number() {
+    require(1);
+    const unsigned char* b = data + pos;
+    pos += 4;
+    return (std::uint32_t)b[0] | (std::uint32_t)b[1] << 8 |
+        (std::uint32_t)b[2] << 16 | (std::uint32_t)b[3] << 24;
+  }
+
+  std::string text(std::uint32_t length) {
+    const std::uint64_t padded = ((std::uint64_t)length + 3) / 4;
+    require(padded);
+    std::string str((const char*)data + pos, length);
+    pos += padded * 4;
+    return str;
+  }
+};
+
+static void writeNumber(std::ofstream& file, const std::uint32_t value) {
+  const char bytes[4] = { (char)value, (char)(value >> 8),
+      (char)(value >> 16), (char)(value >> 24) };
+  file.write(bytes, sizeof(bytes));
+}
+
+/*
+ * Function: createBaseEvent
+ * Description: Creates the base game event with the given name.
+ * Parameters:
+ *    name (string): The name of the event.
+ *    setup (GameSetup*): The setup to get the default event from.
+ * Returns (Event*): The new event, or nullptr if no base event has the name.
+ */
+static Event* createBaseEvent(const std::string& name,
+    const GameSetup* const setup) {
+  if(name == Wumpus::eventName) {
+    return new Wumpus(setup->getDefaultEvent());
+  } else if(name == BatSwarm::eventName) {
+    return new BatSwarm(setup->getDefaultEvent());
+  } else if(name == BottomlessPit::eventName) {
+    return new BottomlessPit(setup->getDefaultEvent());
+  } else if(name == ArrowEvent::eventName) {
+    return new ArrowEvent(setup->getDefaultEvent());
+  } else if(name == EscapeRope::eventName) {
+    return new EscapeRope(setup->getDefaultEvent());
+  } else if(name == GoldEvent::eventName) {
+    return new GoldEvent(setup->getDefaultEvent());
+  }
+  return nullptr;
+}
+
+
+
+RoomPos CaveSnapshot::toPos(const RoomIndex index) const {
+  return RoomPos(index / width, index % width);
+}
+
+CaveSnapshot::CaveSnapshot() : height(0), width(0), topology(GridTopology) {}
+
+CaveSnapshot::CaveSnapshot(const int height, const int width,
+    const int topology) : height(height), width(width), topology(topology) {}
+
+void CaveSnapshot::addEvent(const std::string& name, const RoomIndex room) {
+  // Caves only have a handful of event types, so search them in order
+  int type = 0;
+  while(type < (int)eventTypes.size() && eventTypes[type] != name) {
+    ++type;
+  }
+  if(type == (int)eventTypes.size()) {
+    eventTypes.push_back(name);
+  }
+  events.push_back({ type, room });
+}
+
+void CaveSnapshot::addSpawn(const RoomIndex room) {
+  spawns.push_back(room);
+}
+
+void CaveSnapshot::save(const std::string& path) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if(!file) {
+    throw std::runtime_error("Couldn't create the cave file: " + path);
+  }
+  file.write(magic, sizeof(magic));
+  writeNumber(file, version);
+  writeNumber(file, height);
+  writeNumber(file, width);
+  writeNumber(file, topology);
+  writeNumber(file, eventTypes.size());
+  writeNumber(file, events.size());
+  writeNumber(file, spawns.size());
+
+  for(const std::string& name : eventTypes) {
+    writeNumber(file, name.size());
+    file.write(name.data(), name.size());
+    const char padding[4] = {};
+    file.write(padding, (4 - name.size() % 4) % 4);
+  }
+  for(const Placement& ev : events) {
+    writeNumber(file, ev.type);
+    writeNumber(file, ev.room);
+  }
+  for(RoomIndex room : spawns) {
+    writeNumber(file, room);
+  }
+
+  if(!file) {
+    throw std::runtime_error("Couldn't write the cave file: " + path);
+  }
+}
+
+void CaveSnapshot::load(const std::string& path) {
+  MappedFile file(path);
+  if(file.size() < sizeof(magic) ||
+      std::memcmp(file.begin(), magic, sizeof(magic)) != 0) {
+    throw std::runtime_error("Not a Hunt the Wumpus cave file: " + path);
+  }
+
+  SnapshotReader reader(file.begin(), file.size(), sizeof(magic));
+  std::uint32_t fileVersion = reader.number();
+  if(fileVersion != version) {
+    throw std::runtime_error("Unsupported cave file version: " +
+        std::to_string(fileVersion));
+  }
+
+  height = (int)reader.number();
+  width = (int)reader.number();
+  topology = (int)reader.number();
+  const std::uint64_t roomCount = (std::uint64_t)(std::uint32_t)height *
+      (std::uint32_t)width;
+  if(height <= 0 || width <= 0 || roomCount > (std::uint64_t)INT32_MAX) {
+    throw std::runtime_error("The cave file has an invalid size.");
+  }
+
+  const std::uint32_t typeCount = reader.number();
+  const std::uint32_t eventCount = reader.number();
+  const std::uint32_t spawnCount = reader.number();
+
+  eventTypes.clear();
+  for(std::uint32_t i = 0; i < typeCount; ++i) {
+    eventTypes.push_back(reader.text(reader.number()));
+  }
+
+  // Check the arrays fit in the file before reserving space for them
+  reader.require((std::uint64_t)eventCount * 2 + spawnCount);
+  events.resize(eventCount);
+  for(Placement& ev : events) {
+    std::uint32_t type = reader.number();
+    std::uint32_t room = reader.number();
+    if(type >= typeCount || room >= roomCount) {
+      throw std::runtime_error("The cave file places an event outside the "
+          "cave.");
+    }
+    ev = { (int)type, (RoomIndex)room };
+  }
+  spawns.resize(spawnCount);
+  for(RoomIndex& room : spawns) {
+    std::uint32_t index = reader.number();
+    if(index >= roomCount) {
+      throw std::runtime_error("The cave file places a player outside the "
+          "cave.");
+    }
+    room = (RoomIndex)index;
+  }
+
+  if(!reader.done()) {
+    throw std::runtime_error("The cave file has data after the cave.");
+  }
+}
+
+int CaveSnapshot::getHeight() const {
+  return height;
+}
+int CaveSnapshot::getWidth() const {
+  return width;
+}
+int CaveSnapshot::getTopology() const {
+  return topology;
+}
+
+const std::vector<std::string>& CaveSnapshot::getEventTypes() const {
+  return eventTypes;
+}
+const std::vector<CaveSnapshot::Placement>& CaveSnapshot::getEvents() const {
+  return events;
+}
+const std::vector<RoomIndex>& CaveSnapshot::getSpawns() const {
+  return spawns;
+}
+
+void CaveSnapshot::configure(GameSetup* const setup) const {
+  // The topology may pick its own size, so set the snapshot's size after it
+  setup->setSetupVar(GameSetup::Topology, topology);
+  setup->setSetupVar(GameSetup::Height, height);
+  setup->setSetupVar(GameSetup::Width, width);
+}
+
+void CaveSnapshot::place(GameSetup* const setup) const {
+  if(spawns.empty()) {
+    throw std::runtime_error("The cave snapshot has nowhere for the players "
+        "to start.");
+  }
+
+  // Events from mods are placed first, in the order the mods added them
+  std::unordered_map<std::string, std::vector<Event*>> modEvents;
+  for(Event* ev : setup->getEvents()) {
+    modEvents[ev->name()].push_back(ev);
+  }
+  std::vector<std::size_t> modEventsUsed(eventTypes.size(), 0);
+
+  std::vector<Event*> added;
+  added.reserve(events.size());
+  for(const Placement& placement : events) {
+    const std::string& name = eventTypes[placement.type];
+    Event* ev = nullptr;
+
+    auto fromMods = modEvents.find(name);
+    if(fromMods != modEvents.end()) {
+      std::size_t& used = modEventsUsed[placement.type];
+      if(used < fromMods->second.size()) {
+        fromMods->second[used++]->setLocation(toPos(placement.room));
+        continue;
+      }
+      ev = fromMods->second.front()->clone();
+    } else {
+      ev = createBaseEvent(name, setup);
+    }
+
+    if(!ev) {
+      for(Event* unused : added) {
+        delete unused;
+      }
+      throw std::runtime_error("The cave snapshot has an event that isn't "
+          "in the game: " + name);
+    }
+    ev->setLocation(toPos(placement.room));
+    added.push_back(ev);
+  }
+
+  // Every event from a mod must have been given a room
+  for(const auto& [name, evs] : modEvents) {
+    int type = 0;
+    while(type < (int)eventTypes.size() && eventTypes[type] != name) {
+      ++type;
+    }
+    if(type == (int)eventTypes.size() || modEventsUsed[type] < evs.size()) {
+      for(Event* unused : added) {
+        delete unused;
+      }
+      throw std::runtime_error("The cave snapshot has no room for the event: "
+          + name);
+    }
+  }
+
+  for(Event*& ev : added) {
+    setup->addEvent(ev);
+  }
+  std::size_t spawn = 0;
+  for(Player* pl : setup->getPlayers()) {
+    pl->setLocation(toPos(spawns[spawn]));
+    spawn = (spawn + 1) % spawns.size();
+  }
+}
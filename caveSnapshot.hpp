@@ -0,0 +1,150 @@
+#ifndef CAVE_SNAPSHOT_HPP
+#define CAVE_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gameSetup.hpp"
+#include "htwTypes.hpp"
+
+
+/*
+ * The layout of a set up cave: its size, the events in each room, and the
+ *    rooms the players start in. A snapshot saved from one game can be loaded
+ *    in place of the setup's prompts and random placement, so large caves
+ *    start without placing their events again, and every game of a benchmark
+ *    run can use the same cave.
+ *
+ * File format (every number is a 32-bit little endian unsigned integer, so
+ *    each part of the file stays aligned and can be read where it is mapped):
+ *    "HTWC", version
+ *    height, width, topology
+ *    type count, event count, spawn count
+ *    Each event type: name length, then the name padded to 4 bytes
+ *    Each event: type number, room index
+ *    Each spawn: room index
+ */
+class CaveSnapshot {
+public:
+  static constexpr char magic[4] = { 'H', 'T', 'W', 'C' };
+  static constexpr std::uint32_t version = 1;
+
+  // An event in the snapshot, by the number of its event type
+  struct Placement {
+    int type;
+    RoomIndex room;
+  };
+
+private:
+  int height;
+  int width;
+  // A value of CaveTopologies
+  int topology;
+
+  // The name of each type of event in the cave
+  std::vector<std::string> eventTypes;
+  // Every event in the cave, in row-major order by room
+  std::vector<Placement> events;
+  // The room each player starts in
+  std::vector<RoomIndex> spawns;
+
+  /*
+   * Function: toPos
+   * Description: Converts the index of a room to its position on the board.
+   * Parameters:
+   *    index (RoomIndex): The index to convert.
+   * Returns (RoomPos): The position of the room.
+   */
+  RoomPos toPos(RoomIndex index) const;
+
+public:
+  /*
+   * Function: Default Constructor
+   * Description: Creates an empty snapshot, to be filled by load().
+   */
+  CaveSnapshot();
+
+  /*
+   * Function: Constructor
+   * Description: Creates a snapshot of a cave with the given size and no
+   *    events or players.
+   * Parameters:
+   *    height (int): The number of rows in the cave.
+   *    width (int): The number of columns in the cave.
+   *    topology (int): The layout of the cave, from CaveTopologies.
+   */
+  CaveSnapshot(int height, int width, int topology);
+
+  /*
+   * Function(s): addEvent, addSpawn
+   * Description: Adds an event or a player's starting room to the snapshot.
+   *    Events should be added in the order the cave holds them.
+   * Parameters:
+   *    name (string): The name of the event.
+   *    room (RoomIndex): The index of the room, in row-major order.
+   */
+  void addEvent(const std::string& name, RoomIndex room);
+  void addSpawn(RoomIndex room);
+
+  /*
+   * Function: save
+   * Description: Writes the snapshot to the given file in the format described
+   *    at the top of this file.
+   * Parameters:
+   *    path (string): The file to write.
+   * Effects: Throws std::runtime_error if the file can't be written.
+   */
+  void save(const std::string& path) const;
+
+  /*
+   * Function: load
+   * Description: Reads a snapshot by mapping the file into memory and reading
+   *    its arrays in place, replacing the contents of this snapshot.
+   * Parameters:
+   *    path (string): The file to read.
+   * Effects: Throws std::runtime_error if the file can't be read, isn't a
+   *    snapshot, or places anything outside the cave.
+   */
+  void load(const std::string& path);
+
+  /*
+   * Function(s): getHeight, getWidth, getTopology
+   * Returns (int): The size and layout of the cave.
+   */
+  int getHeight() const;
+  int getWidth() const;
+  int getTopology() const;
+
+  const std::vector<std::string>& getEventTypes() const;
+  const std::vector<Placement>& getEvents() const;
+  const std::vector<RoomIndex>& getSpawns() const;
+
+  /*
+   * Function: configure
+   * Description: Gives the setup the size and layout of the cave in the
+   *    snapshot. Should be called before players and events are loaded.
+   * Parameters:
+   *    setup (GameSetup*): The setup to configure.
+   */
+  void configure(GameSetup* setup) const;
+
+  /*
+   * Function: place
+   * Description: Places the events and players in the setup as the snapshot
+   *    describes, in place of GameSetup::init(). Events already added to the
+   *    setup by mods are placed at the first rooms holding an event of the
+   *    same name, and copied for any further rooms. Other events are created
+   *    from the base game's events. If there are more players than spawns,
+   *    the spawns are reused in order.
+   * Parameters:
+   *    setup (GameSetup*): The configured setup, holding its players and the
+   *      events from mods.
+   * Effects: Throws std::runtime_error if the snapshot has an event no mod or
+   *    base game event matches, a mod's event isn't in the snapshot, or the
+   *    snapshot has no spawns.
+   */
+  void place(GameSetup* setup) const;
+};
+
+#endif
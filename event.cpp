@@ -1,13 +1,14 @@
 #include "event.hpp"
 
 
-Event::Event(Event* defaultEvent) : defaultEvent(defaultEvent), room(NONE) {
+Event::Event(Event* defaultEvent) : defaultEvent(defaultEvent), room(NONE),
+    random(nullptr) {
   if(defaultEvent) {
     defaultEvent->setEventPointer(this);
   }
 }
 Event::Event(Event* defaultEvent, const RoomPos& room) : defaultEvent(defaultEvent),
-    room(room) {
+    room(room), random(nullptr) {
   if(defaultEvent) {
     defaultEvent->setEventPointer(this);
   }
@@ -21,6 +22,10 @@ void Event::setEventPointer(Event* ev) {
   defaultEvent = ev;
 }
 
+void Event::setRandom(Random* const rand) {
+  random = rand;
+}
+
 const RoomPos& Event::getLocation() const {
   return room;
 }
@@ -41,3 +46,7 @@ Item* Event::getItem() { return nullptr; }
 GameUpdate::pointer Event::turnUpdate(Player* player, bool round) {
   return nullptr;
 }
+
+bool Event::receivesTurnUpdates() const {
+  return false;
+}
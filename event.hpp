@@ -4,6 +4,7 @@
 #include "gameUpdatePointer.hpp"
 #include "item.hpp"
 #include "trigger.hpp"
+#include "random.hpp"
 
 
 class Event {
@@ -13,6 +14,8 @@ public:
 protected:
   Event* defaultEvent;
   RoomPos room;
+  // The game's random number generator, set when the event enters the cave
+  Random* random;
 
 public:
   /*
@@ -49,6 +52,15 @@ public:
    *    ev (Event*): The Event pointer to set defaultEvent to.
    */
   void setEventPointer(Event* ev);
+
+  /*
+   * Function: setRandom
+   * Description: Simple setter for the random number generator the event
+   *    should use. Called by the cave when the event is added to it.
+   * Parameters:
+   *    rand (Random*): The game's random number generator.
+   */
+  void setRandom(Random* rand);
   
   /*
    * Function: getLocation
@@ -91,7 +103,9 @@ public:
   /*
    * Function: getPercept
    * Description: Returns a string that warns the player of the event. Will
-   *    only be displayed if the player is close to the event.
+   *    only be displayed if the player is close to the event. Rooms cache
+   *    the percept until the event leaves, so it should only depend on the
+   *    mode.
    * Parameters:
    *    mode (int): The current game display mode.
    * Returns (string): A warning to the player about the event.
@@ -124,6 +138,16 @@ public:
    */
   virtual GameUpdate::pointer turnUpdate(Player* player, bool round);
 
+  /*
+   * Function: receivesTurnUpdates
+   * Description: Whether the cave should call turnUpdate for this event. The
+   *    cave only calls turnUpdate for events that return true, so an event
+   *    overriding turnUpdate should override this as well. It is checked each
+   *    time the event is added to a room.
+   * Returns (bool): False by default.
+   */
+  virtual bool receivesTurnUpdates() const;
+
   /*
    * Function: triggerUpdate
    * Description: A function that is called every time a trigger or player
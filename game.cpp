@@ -3,13 +3,13 @@
 #include <iostream>
 #include <string>
 
-#include "ioSpDef.hpp"
 #include "infoItem.hpp"
+#include "updateArena.hpp"
 
 
 
 int Game::getAction() {
-  int action = getchEsc();
+  int action = io->getKey();
   action = tolower(action);
 
   if(action == 'x') {
@@ -64,20 +64,25 @@ void Game::swapTurn() {
 
 
 void Game::displayGame() {
-  CLEAR_SCREEN;
-
   Player* pl = activePlayer();
   if(activePlayer()->getState() == Player::LostGame ||
       activePlayer()->getState() == Player::WonGame) {
     pl = nullptr;
   }
+  // Checked each turn, in case the terminal was resized
+  int rows = 0;
+  int cols = 0;
+  if(io->getScreenSize(rows, cols)) {
+    cave->setViewSize(rows, cols);
+  }
   std::string output = cave->turnDisplay(pl);
 
-  print(output);
+  // Replaces the last board, so the terminal only redraws what changed
+  io->displayFrame(output);
   boardDisplayed = true;
 
   // Print any queued TextDisplays
-  print(toDisplay);
+  io->display(toDisplay);
   toDisplay.clear();
 }
 
@@ -102,14 +107,14 @@ bool Game::checkLose() const {
 }
 
 bool Game::confirmExit() {
-  print("Are you sure you want to exit the game? (y/n): ");
+  io->display("Are you sure you want to exit the game? (y/n): ");
   int response = getAction();
 
   if(response == 'y') {
-    print("y\n\n");
+    io->display("y\n\n");
     return true;
   } else {
-    print("n\n\n");
+    io->display("n\n\n");
     return false;
   }
 }
@@ -171,10 +176,7 @@ void Game::insertMultiTurn(const GameUpdate::pointer& update, int waitCount) {
       pl = getNextPlayer(pl);
 
       if(passedWaits == waitCount) {
-        GameUpdate::pointer* upds = it->nextPointer();
-        it->setNext(update);
-        it->append(*upds);
-        delete upds;
+        it->insertNext(update);
         return;
       }
     }
@@ -211,60 +213,85 @@ GameUpdate::pointer Game::startTurnUpdate() {
   return update;
 }
 
-GameUpdate::pointer Game::resolveUpdate(const GameUpdate& update) {
-  GameUpdate::pointer addUpdate = nullptr;
-  // Check for cases where the update should be resolved by Game
-  if(update == GameUpdate::WinGame) {
-    displayGame();
-    activePlayer()->setState(Player::WonGame);
-
-    std::string text = update.getMessage();
-    if(!text.empty()) {
-      print("\n\n" + text + "\n");
-      print("\n(Press any key to continue)\n");
-      getchEsc();
-    }
-    addUpdate = new GameUpdate(GameUpdate::ForceGameEnd);
-  }
-  else if(update == GameUpdate::LoseGame) {
-    displayGame();
-    activePlayer()->setState(Player::LostGame);
-
-    std::string text = update.getMessage();
-    if(!text.empty()) {
-      print("\n\n" + text + "\n");
-      print("\n(Press any key to continue)\n");
-      getchEsc();
-    }
-  }
-  else if(update == GameUpdate::SetGameMode) {
-    cave->setGameMode(update.getInfo());
+GameUpdate::pointer Game::resolveWinGame(const GameUpdate& update) {
+  displayGame();
+  activePlayer()->setState(Player::WonGame);
+
+  std::string text(update.getMessage());
+  if(!text.empty()) {
+    io->display("\n\n" + text + "\n");
+    io->display("\n(Press any key to continue)\n");
+    io->getKey();
   }
-  else if(update == GameUpdate::RefreshBoardDisplay) {
-    displayGame();
-    boardDisplayed = true;
+  return new GameUpdate(GameUpdate::ForceGameEnd);
+}
+
+GameUpdate::pointer Game::resolveLoseGame(const GameUpdate& update) {
+  displayGame();
+  activePlayer()->setState(Player::LostGame);
+
+  std::string text(update.getMessage());
+  if(!text.empty()) {
+    io->display("\n\n" + text + "\n");
+    io->display("\n(Press any key to continue)\n");
+    io->getKey();
   }
-  else if(update == GameUpdate::DisplayText) {
-    std::string text = update.getMessage() + '\n';
-    if(boardDisplayed) {
-      print(text);
-    } else {
-      toDisplay += text;
-    }
+  return nullptr;
+}
+
+GameUpdate::pointer Game::resolveSetGameMode(const GameUpdate& update) {
+  cave->setGameMode(update.getInfo());
+  return nullptr;
+}
+
+GameUpdate::pointer Game::resolveRefreshBoard(const GameUpdate&) {
+  displayGame();
+  boardDisplayed = true;
+  return nullptr;
+}
+
+GameUpdate::pointer Game::resolveDisplayText(const GameUpdate& update) {
+  std::string text(update.getMessage());
+  text += '\n';
+  if(boardDisplayed) {
+    io->display(text);
+  } else {
+    toDisplay += text;
   }
-  else if(update == GameUpdate::GetPlayerInput) {
-    int input = getAction();
-    Item* info = new InfoItem(update.getMessage(), input);
-    update.getPlayer()->addItem(info);
-    if(update.getInfo() != 0) {
-      addUpdate = new GameUpdate(GameUpdate::HandlePlayerInput,
-          update.getPlayer(), update.getMessage());
-    }
+  return nullptr;
+}
+
+GameUpdate::pointer Game::resolveGetPlayerInput(const GameUpdate& update) {
+  int input = getAction();
+  Item* info = new InfoItem(std::string(update.getMessage()), input);
+  update.getPlayer()->addItem(info);
+  if(update.getInfo() != 0) {
+    return new GameUpdate(GameUpdate::HandlePlayerInput,
+        update.getPlayer(), update.getMessage());
   }
-  else {
-    addUpdate = cave->updateState(update);
+  return nullptr;
+}
+
+GameUpdate::pointer Game::resolveUpdate(const GameUpdate& update) {
+  typedef GameUpdate::pointer (Game::*Resolver)(const GameUpdate&);
+  // Indexed by update type, built the first time an update is resolved.
+  // Types without an entry are resolved by the cave.
+  static const std::vector<Resolver> resolvers = [] {
+    std::vector<Resolver> table(GameUpdate::FirstModUpdate, nullptr);
+    table[GameUpdate::WinGame] = &Game::resolveWinGame;
+    table[GameUpdate::LoseGame] = &Game::resolveLoseGame;
+    table[GameUpdate::SetGameMode] = &Game::resolveSetGameMode;
+    table[GameUpdate::RefreshBoardDisplay] = &Game::resolveRefreshBoard;
+    table[GameUpdate::DisplayText] = &Game::resolveDisplayText;
+    table[GameUpdate::GetPlayerInput] = &Game::resolveGetPlayerInput;
+    return table;
+  }();
+
+  const int type = update.getType();
+  if(type >= 0 && type < (int)resolvers.size() && resolvers[type]) {
+    return (this->*resolvers[type])(update);
   }
-  return addUpdate;
+  return cave->updateState(update);
 }
 
 bool Game::resolveTurn() {
@@ -320,14 +347,17 @@ bool Game::resolveTurn() {
     // Move to resolving next update (will become null if no next update)
     update.moveToNext();
   }
+  // Show everything the turn displayed at once
+  io->flush();
 
   return !(checkWin() || checkLose());
 }
 
 
 
-Game::Game(GameSetup* setup, Cave* caveSetup) : cave(caveSetup), playing(0),
-    roundStart(true) {
+Game::Game(GameSetup* setup, Cave* caveSetup, GameIO* io) : cave(caveSetup),
+    io(io), playing(0), roundStart(true), turnCount(0),
+    boardDisplayed(false) {
   int gameMode = (GameModeTypes)setup->getSetupVar(GameSetup::GameMode);
   cave->setGameMode(gameMode);
 
@@ -337,19 +367,9 @@ Game::Game(GameSetup* setup, Cave* caveSetup) : cave(caveSetup), playing(0),
   }
   players.at(0)->setState(Player::Active);
   setup->clearPlayers();
-  
-  // Start curses window if using curses library
-  CURSES_INIT;
-  
-  // Pause and wait for key press
-  print("Setup Complete. Press any key to begin...");
-  getchEsc();
 }
 
 Game::~Game() {
-  // Close curses window if using curses library
-  CURSES_END;
-
   // Free any outstanding wait updates
   multiTurnUpdates.deleteNext();
   
@@ -364,6 +384,10 @@ void Game::playGame() {
   bool flag = true;
   while (flag) {
     flag = resolveTurn();
+    turnCount++;
+    // Every update from the turn has been resolved, so unless some are
+    // waiting on a later turn, release all of their memory at once
+    UpdateArena::local().reset();
     if(flag) {
       swapTurn();
     }
@@ -375,18 +399,24 @@ void Game::playGame() {
   // Display a message about the winner if any
   if(checkWin()) {
     if(players.size() == 1) {
-      print("\nYou win!!!\n\n\n");
+      io->display("\nYou win!!!\n\n\n");
     } else {
-      print("\nPlayer " + std::to_string(playing + 1) + " wins!!!!\n\n\n");
+      io->display("\nPlayer " + std::to_string(playing + 1) +
+          " wins!!!!\n\n\n");
     }
   } else if(checkLose()) {
     std::string plural = "";
     if(players.size() != 1) {
       plural = "s";
     }
-    print("\nThe mighty Wumpus has defeated the mere mortal" + plural +
+    io->display("\nThe mighty Wumpus has defeated the mere mortal" + plural +
         " who dared venture into its cave.\n\n\n");
   } else {
-    print("\nExiting. Please wait...\n\n\n");
+    io->display("\nExiting. Please wait...\n\n\n");
   }
+  io->flush();
+}
+
+int Game::getTurnCount() const {
+  return turnCount;
 }
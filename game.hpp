@@ -3,17 +3,20 @@
 
 #include "player.hpp"
 #include "cave.hpp"
+#include "gameIO.hpp"
 
 
 // Game interface
 class Game {
 private:
   Cave* cave;
+  GameIO* io;
 
   int playing;
   std::vector<Player*> players;
 
   bool roundStart;
+  int turnCount;
   // Saves any updates that weren't finished the previous turn
   GameUpdate::pointer multiTurnUpdates;
 
@@ -25,7 +28,7 @@ private:
    * Description: Waits for an action from the user in the form of a key press.
    * Returns (int): The (possibly invalid) action provided by the player.
    */
-  static int getAction();
+  int getAction();
 
   /*
    * Function: playerCount
@@ -65,20 +68,6 @@ private:
    */
   void displayGame();
 
-  /*
-   * Function: checkWin
-   * Description: Determines whether the player has won the game
-   * Returns (bool): True if the player has won, false otherwise
-   */
-  bool checkWin() const;
-
-  /*
-   * Function: checkLose
-   * Description: Determines whether the player has lost the game
-   * Returns (bool): True if the player has lost, false otherwise
-   */
-  bool checkLose() const;
-
   /*
    * Function: confirmExit
    * Description: Prompts the user to make sure they actually want to exit
@@ -150,6 +139,22 @@ private:
    */
   GameUpdate::pointer startTurnUpdate();
 
+  /*
+   * Function(s): Resolve [update type]
+   * Description: Execute the updates resolved by Game rather than the Cave.
+   *    Each is looked up by resolveUpdate using the update's type.
+   * Parameters:
+   *    update (GameUpdate): The update to resolve.
+   * Returns (GameUpdate::pointer): Either a list of updates to add to the
+   *    queue or evaluates to false.
+   */
+  GameUpdate::pointer resolveWinGame(const GameUpdate& update);
+  GameUpdate::pointer resolveLoseGame(const GameUpdate& update);
+  GameUpdate::pointer resolveSetGameMode(const GameUpdate& update);
+  GameUpdate::pointer resolveRefreshBoard(const GameUpdate& update);
+  GameUpdate::pointer resolveDisplayText(const GameUpdate& update);
+  GameUpdate::pointer resolveGetPlayerInput(const GameUpdate& update);
+
   /*
    * Function: resolveUpdate
    * Description: Executes the update action or delegates its resolution to
@@ -179,8 +184,10 @@ public:
    *    setup (GameSetup*): An object derived from GameSetup that provides
    *      parameters used to set up the game object.
    *    cave (Cave*): The cave object that stores the game board.
+   *    io (GameIO*): Where the game is displayed and key presses come from.
+   *      Must outlive the Game object.
    */
-  Game(GameSetup* setup, Cave* cave);
+  Game(GameSetup* setup, Cave* cave, GameIO* io);
 
   /*
    * Functions: Copy/Move Constructor/Assignment
@@ -195,7 +202,6 @@ public:
   /*
    * Function: Destructor
    * Description: Frees memory allocated to players and multi-turn updates.
-   *    Closes the curses library if in use.
    */
   ~Game();
 
@@ -204,5 +210,26 @@ public:
    * Description: Runs one full iteration of the game.
    */
   void playGame();
+
+  /*
+   * Function: checkWin
+   * Description: Determines whether the player has won the game
+   * Returns (bool): True if the player has won, false otherwise
+   */
+  bool checkWin() const;
+
+  /*
+   * Function: checkLose
+   * Description: Determines whether the player has lost the game
+   * Returns (bool): True if the player has lost, false otherwise
+   */
+  bool checkLose() const;
+
+  /*
+   * Function: getTurnCount
+   * Description: Simple getter for the number of turns resolved so far.
+   * Returns (int): The number of turns taken by all players combined.
+   */
+  int getTurnCount() const;
 };
 #endif
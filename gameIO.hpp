@@ -0,0 +1,76 @@
+#ifndef GAME_IO_HPP
+#define GAME_IO_HPP
+
+#include <string_view>
+
+
+// Where Game sends its output and gets its key presses from
+class GameIO {
+public:
+  /*
+   * Function: Destructor
+   * Description: Doesn't explicitly delete anything, but should be marked
+   *    virtual for derived classes.
+   */
+  virtual ~GameIO() = default;
+
+  /*
+   * Function: display
+   * Description: Shows the given text after anything displayed since the
+   *    screen was last cleared.
+   * Parameters:
+   *    text (string_view): The text to display.
+   */
+  virtual void display(std::string_view text) = 0;
+
+  /*
+   * Function: clearScreen
+   * Description: Removes everything displayed so far.
+   */
+  virtual void clearScreen() = 0;
+
+  /*
+   * Function: displayFrame
+   * Description: Replaces everything displayed with the given frame, such as
+   *    the board at the start of a turn. Text displayed afterwards follows the
+   *    frame. By default this clears the screen and displays the frame, but a
+   *    terminal can redraw only what changed since the last frame.
+   * Parameters:
+   *    frame (string_view): The text of the frame.
+   */
+  virtual void displayFrame(std::string_view frame) {
+    clearScreen();
+    display(frame);
+  }
+
+  /*
+   * Function: flush
+   * Description: Shows everything displayed so far, for output that is held
+   *    until a frame is finished. The game calls this once the updates of a
+   *    turn are resolved. Does nothing by default.
+   */
+  virtual void flush() {}
+
+  /*
+   * Function: getScreenSize
+   * Description: Gets the number of lines and columns of text that fit on the
+   *    screen, for output that is shown on one.
+   * Parameters:
+   *    rows (int&): Set to the number of lines.
+   *    cols (int&): Set to the number of columns.
+   * Returns (bool): False if the output has no size limit, in which case rows
+   *    and cols are left unchanged.
+   */
+  virtual bool getScreenSize(int&, int&) {
+    return false;
+  }
+
+  /*
+   * Function: getKey
+   * Description: Waits for the next key press.
+   * Returns (int): The key pressed, in the form returned by getchEsc().
+   */
+  virtual int getKey() = 0;
+};
+
+#endif
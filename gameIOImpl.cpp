@@ -0,0 +1,217 @@
+#include "gameIOImpl.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "ioSpDef.hpp"
+#include "outputSinkImpl.hpp"
+
+
+
+// Splits text into its lines, keeping an empty last line if the text ends in
+// a newline
+static std::vector<std::string> splitLines(const std::string_view text) {
+  std::vector<std::string> lines;
+  std::size_t start = 0;
+  while(true) {
+    std::size_t end = text.find('\n', start);
+    if(end == std::string_view::npos) {
+      lines.emplace_back(text.substr(start));
+      return lines;
+    }
+    lines.emplace_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+}
+
+
+
+void TerminalIO::redrawFrame(const std::vector<std::string>& lines) {
+  // Clear whatever was displayed after the last frame
+  output->moveCursor((int)lastFrame.size() - 1, (int)lastFrame.back().size());
+  output->clearToBottom();
+
+  static const std::string noLine;
+  const std::size_t rows = std::max(lines.size(), lastFrame.size());
+  for(std::size_t row = 0; row < rows; ++row) {
+    const std::string& line = row < lines.size() ? lines[row] : noLine;
+    const std::string& last = row < lastFrame.size() ? lastFrame[row] : noLine;
+
+    // Rewrite each run of characters that changed
+    std::size_t col = 0;
+    while(col < line.size()) {
+      if(col < last.size() && line[col] == last[col]) {
+        col++;
+        continue;
+      }
+      std::size_t end = col;
+      while(end < line.size() && !(end < last.size() &&
+          line[end] == last[end])) {
+        end++;
+      }
+      output->moveCursor((int)row, (int)col);
+      output->write(std::string_view(line).substr(col, end - col));
+      col = end;
+    }
+    if(line.size() < last.size()) {
+      output->moveCursor((int)row, (int)line.size());
+      output->clearToLineEnd();
+    }
+  }
+
+  output->moveCursor((int)lines.size() - 1, (int)lines.back().size());
+}
+
+TerminalIO::TerminalIO(const Backend backend) : backend(backend),
+    output(nullptr), input(nullptr), frameShown(false), cursorRow(0),
+    cursorCol(0), frameScreenRows(0), frameScreenCols(0) {
+#ifdef NO_CURSES
+  this->backend = AnsiBackend;
+#endif
+  if(this->backend == AnsiBackend) {
+    startRawTerminal();
+    output = new AnsiSink();
+  } else {
+    CURSES_INIT;
+    output = new CursesSink();
+  }
+  // Only read keys once the terminal sends them as they are pressed
+  input = new InputReader();
+}
+
+TerminalIO::~TerminalIO() {
+  // Ending curses exits the program, so the reader and sink have to be
+  // finished first
+  delete input;
+  output->flush();
+  delete output;
+  if(backend == AnsiBackend) {
+    endRawTerminal();
+  } else {
+    CURSES_END;
+  }
+}
+
+void TerminalIO::trackCursor(const std::string_view text) {
+  for(char c : text) {
+    if(c == '\n') {
+      cursorRow++;
+      cursorCol = 0;
+    } else if(++cursorCol >= frameScreenCols) {
+      // Count a full line as wrapped, since terminals differ on when the
+      // cursor moves to the next line
+      cursorRow++;
+      cursorCol = 0;
+    }
+    if(cursorRow >= frameScreenRows) {
+      frameShown = false;
+      return;
+    }
+  }
+}
+
+void TerminalIO::display(const std::string_view text) {
+  output->write(text);
+  if(frameShown) {
+    trackCursor(text);
+  }
+}
+
+void TerminalIO::clearScreen() {
+  output->clear();
+  frameShown = false;
+}
+
+void TerminalIO::flush() {
+  output->flush();
+}
+
+int TerminalIO::getKey() {
+  // Show the whole frame before waiting for the player
+  output->flush();
+  return input->nextKey();
+}
+
+void TerminalIO::displayFrame(const std::string_view frame) {
+  int screenRows = 0;
+  int screenCols = 0;
+  if(!output->hasCursor() || !output->getSize(screenRows, screenCols)) {
+    GameIO::displayFrame(frame);
+    return;
+  }
+  std::vector<std::string> lines = splitLines(frame);
+
+  // Lines that wrap or run off the bottom wouldn't be where the frame says,
+  // so only redraw frames that fit on the screen
+  bool fits = (int)lines.size() <= screenRows;
+  for(std::size_t i = 0; fits && i < lines.size(); ++i) {
+    fits = (int)lines[i].size() < screenCols;
+  }
+
+  if(frameShown && fits) {
+    redrawFrame(lines);
+  } else {
+    GameIO::displayFrame(frame);
+  }
+  // Both leave the cursor at the end of the frame
+  cursorRow = (int)lines.size() - 1;
+  cursorCol = (int)lines.back().size();
+  frameScreenRows = screenRows;
+  frameScreenCols = screenCols;
+  lastFrame = std::move(lines);
+  frameShown = fits;
+}
+
+bool TerminalIO::getScreenSize(int& rows, int& cols) {
+  return output->getSize(rows, cols);
+}
+
+
+
+ScriptedIO::ScriptedIO(const std::vector<int>& keys, const bool record) :
+    keys(keys), keyIndex(0), recording(record) {}
+
+ScriptedIO::ScriptedIO(KeySource source, const bool record) :
+    nextKey(std::move(source)), keyIndex(0), recording(record) {}
+
+void ScriptedIO::display(const std::string_view text) {
+  if(recording) {
+    output += text;
+  }
+}
+
+void ScriptedIO::clearScreen() {
+  if(recording) {
+    output += '\f';
+  }
+}
+
+int ScriptedIO::getKey() {
+  if(nextKey) {
+    keyIndex++;
+    return nextKey();
+  }
+  if(keyIndex == keys.size()) {
+    throw std::out_of_range("The input script ran out of keys after " +
+        std::to_string(keyIndex) + " key presses.");
+  }
+  return keys[keyIndex++];
+}
+
+bool ScriptedIO::getScreenSize(int& rows, int& cols) {
+  if(recording) {
+    return false;
+  }
+  rows = hiddenRows;
+  cols = hiddenCols;
+  return true;
+}
+
+const std::string& ScriptedIO::getOutput() const {
+  return output;
+}
+
+std::size_t ScriptedIO::keysPressed() const {
+  return keyIndex;
+}
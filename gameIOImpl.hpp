@@ -0,0 +1,205 @@
+#ifndef GAME_IO_IMPL_HPP
+#define GAME_IO_IMPL_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gameIO.hpp"
+#include "inputReader.hpp"
+#include "outputSink.hpp"
+
+
+// Plays the game in the terminal, using curses if it is available or raw ANSI
+// escape codes. Output goes through an OutputSink, which is only flushed
+// before waiting for a key or when the game asks, so each frame reaches the
+// terminal at once. Keys are read by an InputReader, so the player can type
+// ahead.
+class TerminalIO : public GameIO {
+public:
+  // How the terminal is driven
+  enum Backend {
+    // Curses, or the console on Windows
+    CursesBackend,
+    // termios and ANSI escape codes, without curses
+    AnsiBackend
+  };
+
+  // Builds without curses (make CURSES=0) only have the ANSI backend
+#ifdef NO_CURSES
+  static constexpr Backend defaultBackend = AnsiBackend;
+#else
+  static constexpr Backend defaultBackend = CursesBackend;
+#endif
+
+private:
+  Backend backend;
+  // Where the text is drawn, owned by this object
+  OutputSink* output;
+  // Reads the keys on another thread, owned by this object
+  InputReader* input;
+
+  // The lines of the frame on the screen, if frameShown is true
+  std::vector<std::string> lastFrame;
+  bool frameShown;
+  // Where the cursor is on the screen while frameShown is true, and the size
+  // of the screen the frame was drawn on
+  int cursorRow;
+  int cursorCol;
+  int frameScreenRows;
+  int frameScreenCols;
+
+  /*
+   * Function: trackCursor
+   * Description: Follows the cursor through text written after the frame.
+   *    If the text could have scrolled the screen, the frame is no longer at
+   *    the top, so frameShown is cleared and the next frame is drawn in full.
+   * Parameters:
+   *    text (string_view): The text written at the cursor.
+   */
+  void trackCursor(std::string_view text);
+
+  /*
+   * Function: redrawFrame
+   * Description: Changes the frame on the screen into the given one, by
+   *    clearing the text displayed after the last frame then rewriting only
+   *    the runs of characters that differ. Leaves the cursor at the end of
+   *    the new frame.
+   * Parameters:
+   *    lines (vector<string>): The lines of the new frame.
+   */
+  void redrawFrame(const std::vector<std::string>& lines);
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Takes over the terminal with the given backend. Curses
+   *    starts its window and is drawn on with a CursesSink. The ANSI backend
+   *    puts the terminal in raw mode (startRawTerminal) and draws with an
+   *    AnsiSink, without loading curses or keeping a copy of the screen.
+   * Parameters:
+   *    backend (Backend): How to drive the terminal. Builds without curses
+   *      always use the ANSI backend.
+   */
+  TerminalIO(Backend backend = defaultBackend);
+
+  /*
+   * Function(s): Copy/Move Constructor/Assignment
+   * Description: There is only one terminal, so this object can't be copied.
+   */
+  TerminalIO(const TerminalIO&) = delete;
+  TerminalIO(TerminalIO&&) = delete;
+  TerminalIO& operator=(const TerminalIO&) = delete;
+  TerminalIO& operator=(TerminalIO&&) = delete;
+
+  /*
+   * Function: Destructor
+   * Description: Stops reading keys, flushes and deletes the sink, then
+   *    gives the terminal back. Closing the curses window ends the program.
+   */
+  ~TerminalIO() override;
+
+  void display(std::string_view text) override;
+  void clearScreen() override;
+  void flush() override;
+
+  /*
+   * Function: getKey
+   * Description: Flushes the sink, so the player sees everything displayed,
+   *    then takes the oldest key pressed, waiting for one if the player
+   *    hasn't typed ahead.
+   * Returns (int): The key pressed, in the form returned by getchEsc().
+   */
+  int getKey() override;
+
+  /*
+   * Function: displayFrame
+   * Description: Draws the first frame in full, then only the characters
+   *    that changed since the last frame, so the output is proportional to
+   *    the change rather than the size of the board. Frames that don't fit
+   *    on the screen, or sinks that can't move the cursor, are drawn in
+   *    full.
+   * Parameters:
+   *    frame (string_view): The text of the frame.
+   */
+  void displayFrame(std::string_view frame) override;
+
+  /*
+   * Function: getScreenSize
+   * Description: Gets the size of the sink's screen, which is checked again
+   *    each time so resizing the terminal is noticed.
+   */
+  bool getScreenSize(int& rows, int& cols) override;
+};
+
+
+// Plays the game without a terminal, taking key presses from a script and
+// optionally recording the output. Used for simulations and testing.
+class ScriptedIO : public GameIO {
+public:
+  // Returns the next key to press
+  typedef std::function<int()> KeySource;
+
+private:
+  KeySource nextKey;
+  std::vector<int> keys;
+  std::size_t keyIndex;
+
+  bool recording;
+  std::string output;
+
+  // The screen size reported when the output isn't recorded
+  static constexpr int hiddenRows = 24;
+  static constexpr int hiddenCols = 80;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Presses the given keys in order. getKey() throws
+   *    std::out_of_range once every key has been pressed.
+   * Parameters:
+   *    keys (vector<int>): The keys to press.
+   *    record (bool): Whether to save the output displayed.
+   */
+  ScriptedIO(const std::vector<int>& keys, bool record = false);
+
+  /*
+   * Function: Constructor
+   * Description: Calls the given function each time a key is needed.
+   * Parameters:
+   *    source (KeySource): The function that decides the keys to press.
+   *    record (bool): Whether to save the output displayed.
+   */
+  ScriptedIO(KeySource source, bool record = false);
+
+  void display(std::string_view text) override;
+  void clearScreen() override;
+  int getKey() override;
+
+  /*
+   * Function: getScreenSize
+   * Description: Output that isn't recorded is thrown away, so when not
+   *    recording this reports a small terminal (hiddenRows by hiddenCols).
+   *    The cave then only draws the window of rooms around the player,
+   *    instead of building the whole board of a large cave each turn.
+   * Returns (bool): True if the output isn't being recorded.
+   */
+  bool getScreenSize(int& rows, int& cols) override;
+
+  /*
+   * Function: getOutput
+   * Description: Getter for the output recorded so far. Each time the screen
+   *    was cleared is marked with a form feed character ('\f').
+   * Returns (string): Everything displayed, or an empty string if the output
+   *    isn't being recorded.
+   */
+  const std::string& getOutput() const;
+
+  /*
+   * Function: keysPressed
+   * Returns (size_t): The number of times getKey() has returned a key.
+   */
+  std::size_t keysPressed() const;
+};
+
+#endif
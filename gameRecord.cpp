@@ -0,0 +1,238 @@
+#include "gameRecord.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include "htwTypes.hpp"
+
+
+
+// Reads the encodings written by GameRecord from a buffer, throwing if the
+// buffer ends partway through a value
+class RecordReader {
+private:
+  const std::vector<char>& data;
+  std::size_t pos;
+
+  std::uint8_t byte() {
+    if(pos == data.size()) {
+      throw std::runtime_error("The record file ends in the middle of an "
+          "entry.");
+    }
+    return (std::uint8_t)data[pos++];
+  }
+
+public:
+  RecordReader(const std::vector<char>& data, std::size_t pos) : data(data),
+      pos(pos) {}
+
+  bool done() const {
+    return pos == data.size();
+  }
+
+  std::uint8_t tag() {
+    return byte();
+  }
+
+  std::uint64_t varint() {
+    std::uint64_t value = 0;
+    for(int shift = 0; shift < 64; shift += 7) {
+      std::uint8_t b = byte();
+      value |= (std::uint64_t)(b & 0x7f) << shift;
+      if(!(b & 0x80)) {
+        return value;
+      }
+    }
+    throw std::runtime_error("The record file has an invalid number.");
+  }
+
+  int signedValue() {
+    std::uint64_t zigzag = varint();
+    return (int)(std::int64_t)((zigzag >> 1) ^ -(zigzag & 1));
+  }
+
+  std::uint64_t fixed() {
+    std::uint64_t value = 0;
+    for(int i = 0; i < 8; ++i) {
+      value |= (std::uint64_t)byte() << (8 * i);
+    }
+    return value;
+  }
+};
+
+
+
+void GameRecord::writeVarint(std::uint64_t value) {
+  while(value >= 0x80) {
+    file.put((char)(value | 0x80));
+    value >>= 7;
+  }
+  file.put((char)value);
+}
+
+void GameRecord::writeSigned(const int value) {
+  const std::int64_t wide = value;
+  writeVarint(((std::uint64_t)wide << 1) ^ (std::uint64_t)(wide >> 63));
+}
+
+void GameRecord::writeFixed(const std::uint64_t value) {
+  for(int i = 0; i < 8; ++i) {
+    file.put((char)(value >> (8 * i)));
+  }
+}
+
+
+
+GameRecord::GameRecord() : mode(Idle), keyIndex(0), drawIndex(0) {}
+
+void GameRecord::startRecording(const std::string& path) {
+  file.open(path, std::ios::binary | std::ios::trunc);
+  if(!file) {
+    throw std::runtime_error("Couldn't create the record file: " + path);
+  }
+  file.write(magic, sizeof(magic));
+  file.put((char)version);
+  mode = Recording;
+}
+
+void GameRecord::load(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if(!in) {
+    throw std::runtime_error("Couldn't open the record file: " + path);
+  }
+  std::vector<char> data((std::istreambuf_iterator<char>(in)),
+      std::istreambuf_iterator<char>());
+
+  constexpr std::size_t headerSize = sizeof(magic) + 1;
+  if(data.size() < headerSize ||
+      std::memcmp(data.data(), magic, sizeof(magic)) != 0) {
+    throw std::runtime_error("Not a Hunt the Wumpus record file: " + path);
+  }
+  if((std::uint8_t)data[sizeof(magic)] != version) {
+    throw std::runtime_error("Unsupported record file version: " +
+        std::to_string((int)(std::uint8_t)data[sizeof(magic)]));
+  }
+
+  RecordReader reader(data, headerSize);
+  while(!reader.done()) {
+    std::uint8_t tag = reader.tag();
+    if(tag == KeyEntry) {
+      keys.push_back(reader.signedValue());
+    } else if(tag == DrawEntry) {
+      draws.push_back(reader.fixed());
+    } else if(tag == SetupEntry) {
+      int type = reader.signedValue();
+      setupVars[type] = reader.signedValue();
+    } else {
+      throw std::runtime_error("The record file has an unknown entry type: " +
+          std::to_string((int)tag));
+    }
+  }
+  mode = Replaying;
+}
+
+bool GameRecord::recording() const {
+  return mode == Recording;
+}
+bool GameRecord::replaying() const {
+  return mode == Replaying;
+}
+
+void GameRecord::recordSetup(const GameSetup* const setup) {
+  if(mode != Recording) {
+    return;
+  }
+  // Any value can be a real setting, including NONE (such as a seed of -1),
+  // so the setup is asked how many variables it has
+  const int count = setup->setupVarCount();
+  for(int type = 0; type < count; ++type) {
+    int value = setup->getSetupVar(type);
+    file.put((char)SetupEntry);
+    writeSigned(type);
+    writeSigned(value);
+  }
+  file.flush();
+}
+
+const std::map<int, int>& GameRecord::getSetupVars() const {
+  return setupVars;
+}
+
+void GameRecord::recordKey(const int key) {
+  if(mode != Recording) {
+    return;
+  }
+  file.put((char)KeyEntry);
+  writeSigned(key);
+  file.flush();
+}
+
+void GameRecord::flush() {
+  if(mode == Recording) {
+    file.flush();
+  }
+}
+
+int GameRecord::nextKey() {
+  if(keyIndex == keys.size()) {
+    throw std::out_of_range("The record has no keys left to replay.");
+  }
+  return keys[keyIndex++];
+}
+
+std::uint64_t GameRecord::draw(const std::uint64_t generated) {
+  if(mode == Replaying) {
+    if(drawIndex == draws.size()) {
+      throw std::out_of_range("The record has no random numbers left to "
+          "replay.");
+    }
+    return draws[drawIndex++];
+  }
+  if(mode == Recording) {
+    file.put((char)DrawEntry);
+    writeFixed(generated);
+  }
+  return generated;
+}
+
+std::size_t GameRecord::keyCount() const {
+  return keys.size();
+}
+std::size_t GameRecord::drawCount() const {
+  return draws.size();
+}
+
+
+
+RecordIO::RecordIO(GameIO* const io, GameRecord* const record) : io(io),
+    record(record) {}
+
+void RecordIO::display(const std::string_view text) {
+  io->display(text);
+}
+
+void RecordIO::clearScreen() {
+  io->clearScreen();
+}
+
+void RecordIO::displayFrame(const std::string_view frame) {
+  io->displayFrame(frame);
+}
+
+void RecordIO::flush() {
+  io->flush();
+}
+
+bool RecordIO::getScreenSize(int& rows, int& cols) {
+  return io->getScreenSize(rows, cols);
+}
+
+int RecordIO::getKey() {
+  if(record->replaying()) {
+    return record->nextKey();
+  }
+  int key = io->getKey();
+  record->recordKey(key);
+  return key;
+}
@@ -0,0 +1,180 @@
+#ifndef GAME_RECORD_HPP
+#define GAME_RECORD_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gameIO.hpp"
+#include "gameSetup.hpp"
+#include "random.hpp"
+
+
+/*
+ * Records everything a game depends on that doesn't come from its code: the
+ *    setup variables, each key pressed, and each random number drawn. Playing
+ *    a game again with the same record reproduces it exactly, even if the
+ *    random number generator has changed since.
+ *
+ * File format (integers are LEB128 varints, signed ones zigzag encoded):
+ *    "HTWR", version byte
+ *    Entries until the end of the file, each starting with a tag byte:
+ *      KeyEntry: signed key
+ *      DrawEntry: the 64-bit number drawn, little endian
+ *      SetupEntry: signed type, signed value
+ */
+class GameRecord : public RandomStream {
+public:
+  static constexpr char magic[4] = { 'H', 'T', 'W', 'R' };
+  static constexpr std::uint8_t version = 1;
+
+  enum EntryTag : std::uint8_t {
+    KeyEntry,
+    DrawEntry,
+    SetupEntry,
+  };
+
+private:
+  enum Mode {
+    Idle,
+    Recording,
+    Replaying,
+  };
+
+  Mode mode;
+  std::ofstream file;
+
+  std::map<int, int> setupVars;
+  std::vector<int> keys;
+  std::vector<std::uint64_t> draws;
+  std::size_t keyIndex;
+  std::size_t drawIndex;
+
+  /*
+   * Function(s): Write [value]
+   * Description: Append a value to the record file in the encoding described
+   *    at the top of this file.
+   */
+  void writeVarint(std::uint64_t value);
+  void writeSigned(int value);
+  void writeFixed(std::uint64_t value);
+
+public:
+  /*
+   * Function: Default Constructor
+   * Description: Creates a record that neither records nor replays.
+   */
+  GameRecord();
+
+  /*
+   * Function: startRecording
+   * Description: Creates the given file and writes the header. Every key and
+   *    random number recorded afterwards is appended to it.
+   * Parameters:
+   *    path (string): The file to record to.
+   * Effects: Throws std::runtime_error if the file can't be created.
+   */
+  void startRecording(const std::string& path);
+
+  /*
+   * Function: load
+   * Description: Reads a record file so the game can be replayed from it.
+   * Parameters:
+   *    path (string): The file to replay.
+   * Effects: Throws std::runtime_error if the file can't be read or isn't a
+   *    record file.
+   */
+  void load(const std::string& path);
+
+  bool recording() const;
+  bool replaying() const;
+
+  /*
+   * Function: recordSetup
+   * Description: Records every setup variable of the given setup, from type
+   *    0 up to its setupVarCount().
+   * Parameters:
+   *    setup (GameSetup*): The setup of the game being recorded.
+   */
+  void recordSetup(const GameSetup* setup);
+
+  /*
+   * Function: getSetupVars
+   * Description: Getter for the setup variables of the loaded record.
+   * Returns (map<int, int>): The value of each setup variable by type.
+   */
+  const std::map<int, int>& getSetupVars() const;
+
+  /*
+   * Function: recordKey
+   * Description: Appends a key press to the record and flushes the file, so
+   *    the record is complete up to the last key if the game crashes.
+   * Parameters:
+   *    key (int): The key pressed.
+   */
+  void recordKey(int key);
+
+  /*
+   * Function: flush
+   * Description: Writes any buffered entries to the record file. The
+   *    terminal ends the program when it closes, before the record is
+   *    destroyed, so the game flushes the record before closing it.
+   */
+  void flush();
+
+  /*
+   * Function: nextKey
+   * Description: Gets the next key pressed in the loaded record.
+   * Returns (int): The key pressed.
+   * Effects: Throws std::out_of_range if every recorded key has been used.
+   */
+  int nextKey();
+
+  /*
+   * Function: draw
+   * Description: Records the generated number when recording, or replaces it
+   *    with the next recorded number when replaying.
+   * Parameters:
+   *    generated (uint64_t): The number the generator produced.
+   * Returns (uint64_t): The number to use.
+   * Effects: Throws std::out_of_range if every recorded number has been used.
+   */
+  std::uint64_t draw(std::uint64_t generated) override;
+
+  /*
+   * Function(s): keyCount, drawCount
+   * Returns (size_t): The number of keys or random numbers in the record.
+   */
+  std::size_t keyCount() const;
+  std::size_t drawCount() const;
+};
+
+
+// Passes display calls through to another GameIO object, and records the
+// keys pressed or replaces them with keys from a record
+class RecordIO : public GameIO {
+private:
+  GameIO* io;
+  GameRecord* record;
+
+public:
+  /*
+   * Function: Constructor
+   * Parameters:
+   *    io (GameIO*): Where output is displayed, and where keys come from when
+   *      not replaying.
+   *    record (GameRecord*): The record to add keys to or take them from.
+   */
+  RecordIO(GameIO* io, GameRecord* record);
+
+  void display(std::string_view text) override;
+  void clearScreen() override;
+  void displayFrame(std::string_view frame) override;
+  void flush() override;
+  bool getScreenSize(int& rows, int& cols) override;
+  int getKey() override;
+};
+
+#endif
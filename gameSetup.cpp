@@ -1,8 +1,13 @@
 #include "gameSetup.hpp"
 
+#include <random>
+#include <stdexcept>
+#include <string>
+
 
 GameSetup::GameSetup(const Event* const defaultEvent) :
-    defaultEvent(defaultEvent) {}
+    topology(GridTopology), seed((int)std::random_device()()),
+    random((std::uint32_t)seed), defaultEvent(defaultEvent) {}
 
 GameSetup::~GameSetup() {
   delete defaultEvent;
@@ -22,14 +27,50 @@ int GameSetup::getSetupVar(const int type) const {
     return dimensions.at(0);
   } else if(type == Width) {
     return dimensions.at(1);
+  } else if(type == Seed) {
+    return seed;
+  } else if(type == Topology) {
+    return topology;
   }
   return NONE;
 }
 
+void GameSetup::setSetupVar(const int type, const int value) {
+  if(type == GameMode) {
+    gameMode = value;
+  } else if(type == Height || type == Width) {
+    dimensions.resize(2);
+    dimensions.at(type == Height ? 0 : 1) = value;
+  } else if(type == Seed) {
+    seed = value;
+    random.seed((std::uint32_t)seed);
+  } else if(type == Topology) {
+    topology = value;
+    if(topology == DodecahedronTopology) {
+      // Number the 20 rooms on a 4x5 board
+      dimensions = { 4, 5 };
+    }
+  } else {
+    throw std::invalid_argument("Unknown setup variable: " +
+        std::to_string(type));
+  }
+}
+
+int GameSetup::setupVarCount() const {
+  return SetupVariableCount;
+}
+
 Event* GameSetup::getDefaultEvent() const {
   return defaultEvent->clone();
 }
 
+Random& GameSetup::getRandom() {
+  return random;
+}
+const Random& GameSetup::getRandom() const {
+  return random;
+}
+
 const std::vector<Event*>& GameSetup::getEvents() const {
   return events;
 }
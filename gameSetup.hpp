@@ -3,6 +3,7 @@
 
 #include "event.hpp"
 #include "player.hpp"
+#include "random.hpp"
 
 
 class GameSetup {
@@ -11,11 +12,21 @@ public:
     GameMode,
     Height,
     Width,
+    Seed,
+    Topology,
+    // The number of variables above. Mods number their own from here.
+    SetupVariableCount
   };
 
 protected:
   int gameMode;
   std::vector<int> dimensions;
+  // A value of CaveTopologies
+  int topology;
+
+  int seed;
+  // Used for placing events, then copied by the cave for the rest of the game
+  Random random;
 
   const Event* defaultEvent;
   std::vector<Event*> events;
@@ -24,7 +35,8 @@ protected:
 public:
   /*
    * Function: Constructor
-   * Description: Initializes default event to the given value.
+   * Description: Initializes default event to the given value, and seeds
+   *    the random number generator with a random seed.
    */
   GameSetup(const Event* defaultEvent);
 
@@ -61,6 +73,30 @@ public:
    */
   virtual int getSetupVar(int type) const;
 
+  /*
+   * Function: setSetupVar
+   * Description: Sets a variable that would otherwise be entered by the user
+   *    during a promptConfigurations() call, so a game can be set up without
+   *    prompting. Mods that override getSetupVar() should override this too.
+   *    Choosing the dodecahedron Topology also sets the board to 4x5, which
+   *    numbers its 20 rooms.
+   * Parameters:
+   *    type (int): The variable to set, according to SetupVariables.
+   *    value (int): The value to give the variable.
+   * Effects: Throws std::invalid_argument if type doesn't correspond to any
+   *    member variables.
+   */
+  virtual void setSetupVar(int type, int value);
+
+  /*
+   * Function: setupVarCount
+   * Description: Returns the number of setup variables, so every one can be
+   *    saved, such as in a game record. Mods that add setup variables should
+   *    override this to include them.
+   * Returns (int): One more than the highest setup variable type.
+   */
+  virtual int setupVarCount() const;
+
   /*
    * Function: getDefaultEvent
    * Description: Getter for the default event
@@ -68,6 +104,15 @@ public:
    *    consistent across events.
    */
   Event* getDefaultEvent() const;
+
+  /*
+   * Function: getRandom
+   * Description: Getter for the random number generator, seeded by the Seed
+   *    setup variable.
+   * Returns (Random&): The game's random number generator.
+   */
+  Random& getRandom();
+  const Random& getRandom() const;
   
   /*
    * Function: getEvents
@@ -1,8 +1,7 @@
 #include "gameSetupImpl.hpp"
 
 #include <iostream>
-#include <random>
-#include <ctime>
+#include <cmath>
 
 #include "game.hpp"
 #include "goldEvent.hpp"
@@ -16,7 +15,7 @@
 
 // Game implementation
 int BasicSetup::randomNumber(const int max) {
-  return rand() % max;
+  return random.index(max);
 }
 
 std::vector<int> BasicSetup::chooseUnique(const int maxNum, const int toChoose) {
@@ -93,20 +92,25 @@ int BasicSetup::promptUserInputWithRange(const std::string& prompt,
 
 
 
-BasicSetup::BasicSetup(const Event* defaultEvent) : GameSetup(defaultEvent->clone()) {
-  srand(time(nullptr));
-}
+BasicSetup::BasicSetup(const Event* defaultEvent) : GameSetup(defaultEvent->clone()) {}
 
 void BasicSetup::promptConfigurations() {
   constexpr int minCaveSize = 4;
-  constexpr int maxCaveSize = 30;
+  // Caves past SparseCave::minRooms only store their occupied rooms, so the
+  // limit is set by the time it takes to set up the board
+  constexpr int maxCaveSize = 4096;
   constexpr int numGameModes = 2;
-
-  dimensions.resize(2);
-  dimensions[1] = promptUserInputWithRange("Enter the game board width",
-      minCaveSize, maxCaveSize);
-  dimensions[0] = promptUserInputWithRange("Enter the game board height",
-      minCaveSize, maxCaveSize);
+  constexpr int numTopologies = 2;
+
+  setSetupVar(Topology, promptUserInput("Would you like to play in the "
+      "classic dodecahedron cave? (1-yes, 0-no): ", 0, numTopologies - 1));
+  if(topology == GridTopology) {
+    dimensions.resize(2);
+    dimensions[1] = promptUserInputWithRange("Enter the game board width",
+        minCaveSize, maxCaveSize);
+    dimensions[0] = promptUserInputWithRange("Enter the game board height",
+        minCaveSize, maxCaveSize);
+  }
 
   gameMode = promptUserInput("Would you like to play in debug mode? "
       "(1-yes, 0-no): ", 0, numGameModes - 1);
@@ -150,6 +154,10 @@ void BasicSetup::init() {
       width) / 4.0);
   // Find each room the gold could be placed in
   std::vector<int> possibleGoldLoc;
+  // On small boards every empty room may be too close, so also keep the
+  // farthest empty rooms to fall back on
+  std::vector<int> farthestLoc;
+  int farthestDist = -1;
   std::vector<int>::iterator filledRooms = rooms.begin();
   for(int rw = 0; rw < height; ++rw) {
     for(int col = 0; col < width; ++col) {
@@ -159,11 +167,22 @@ void BasicSetup::init() {
         continue;
       }
       // Make sure the gold location is far enough away from the players
-      if(abs(rw - ropeLocation.row) + abs(col - ropeLocation.col) > minDist) {
+      int dist = abs(rw - ropeLocation.row) + abs(col - ropeLocation.col);
+      if(dist > minDist) {
         possibleGoldLoc.push_back(rw * width + col);
       }
+      if(dist > farthestDist) {
+        farthestDist = dist;
+        farthestLoc.clear();
+      }
+      if(dist == farthestDist) {
+        farthestLoc.push_back(rw * width + col);
+      }
     }
   }
+  if(possibleGoldLoc.empty()) {
+    possibleGoldLoc = farthestLoc;
+  }
   
   // Add and find the gold event in the list of events
   addEventType<GoldEvent>();
@@ -16,7 +16,7 @@ protected:
    *    max (int): The exclusive maximum of the random number to be generated.
    * Returns (int): A random number between zero and the given maximum.
    */
-  static int randomNumber(int max);
+  int randomNumber(int max);
 
   /*
    * Function: chooseUnique
@@ -30,7 +30,7 @@ protected:
    * Returns (vector<int>): A sorted list of unique random numbers between zero
    *    and the given maximum.
    */
-  static std::vector<int> chooseUnique(int maxNum, int toChoose);
+  std::vector<int> chooseUnique(int maxNum, int toChoose);
 
   /*
    * Function: chooseUniqueUnordered
@@ -39,7 +39,7 @@ protected:
    *    toChoose (int): The number of numbers to rearrange.
    * Returns (vector<int>): An arrangement of numbers.
    */
-  static std::vector<int> chooseUniqueUnordered(int toChoose);
+  std::vector<int> chooseUniqueUnordered(int toChoose);
 
   /*
    * Function: promptUserInput, promptUserInputWithRange
@@ -90,8 +90,7 @@ public:
   /*
    * Function: Constructor
    * Description: Clones the passed default event and stores the pointer for
-   *    later use in setup. Also seeds random.
-   * Effects: Random is seeded with the system time.
+   *    later use in setup.
    */
   BasicSetup(const Event* defaultEvent);
 
@@ -1,8 +1,8 @@
 #include "gameUpdate.hpp"
 
 #include "player.hpp"
-#include "infoEvent.hpp"
-#include "infoTrigger.hpp"
+#include "event.hpp"
+#include "updateArena.hpp"
 
 
 GameUpdate::GameUpdate(const int type) : type(type) {}
@@ -20,22 +20,17 @@ GameUpdate::GameUpdate(const int type, Trigger* const trigger) :
     targetTrigger = trigger;
   }
 }
-GameUpdate::GameUpdate(const int type, const std::string& message) : type(type),
-    targetTrigger(new InfoTrigger(message)),
-    toDelete(WhatToDelete::TargetTrigger) {}
+GameUpdate::GameUpdate(const int type, const UpdateText& message) :
+    type(type), message(message) {}
 
-GameUpdate::GameUpdate(const int type, const std::string& message,
-    const int info) : type(type), info(info),
-    targetTrigger(new InfoTrigger(message)),
-    toDelete(WhatToDelete::TargetTrigger) {}
+GameUpdate::GameUpdate(const int type, const UpdateText& message,
+    const int info) : type(type), info(info), message(message) {}
 
 
 GameUpdate::GameUpdate(const int type, Event* const event,
     const int info) : type(type), info(info), targetEvent(event) {}
 GameUpdate::GameUpdate(const int type, Event* const event,
-    const RoomPos room) : type(type), info(info), targetEvent(event),
-    targetTrigger(new InfoTrigger(room)),
-    toDelete(WhatToDelete::TargetTrigger) {}
+    const RoomPos room) : type(type), targetEvent(event), room(room) {}
 GameUpdate::GameUpdate(const int type, Event* const event,
     const WhatToDelete toDelete) : type(type), targetEvent(event),
     toDelete(toDelete) {}
@@ -50,8 +45,7 @@ GameUpdate::GameUpdate(const int type, Trigger* const trigger,
   }
 }
 GameUpdate::GameUpdate(const int type, Trigger* const trigger,
-    const RoomPos room) : type(type), targetEvent(new InfoEvent(room)),
-    toDelete(WhatToDelete::TargetEvent) {
+    const RoomPos room) : type(type), room(room) {
   Player* player = trigger->player();
   if(player) {
     targetPlayer = player;
@@ -74,13 +68,11 @@ GameUpdate::GameUpdate(const int type, Player* const player,
     Event* const event) : type(type), targetPlayer(player),
     targetEvent(event) {}
 GameUpdate::GameUpdate(const int type, Player* const player,
-    Event* const event, const int info) : type(type), targetPlayer(player),
-    targetEvent(event), info(info) {}
+    Event* const event, const int info) : type(type), info(info),
+    targetPlayer(player), targetEvent(event) {}
 GameUpdate::GameUpdate(const int type, Player* const player,
-    Event* const event, const std::string& message) :
-    type(type), targetPlayer(player), targetEvent(event),
-    targetTrigger(new InfoTrigger(message)),
-    toDelete(WhatToDelete::TargetEvent) {}
+    Event* const event, const UpdateText& message) : type(type),
+    targetPlayer(player), targetEvent(event), message(message) {}
 
 GameUpdate::GameUpdate(const int type, Player* const player,
     Trigger* const trigger) : type(type), targetPlayer(player),
@@ -89,22 +81,18 @@ GameUpdate::GameUpdate(const int type, Player* const player,
     Trigger* const trigger, const int info) : type(type), info(info),
     targetPlayer(player), targetTrigger(trigger) {}
 GameUpdate::GameUpdate(const int type, Player* const player,
-    Trigger* const trigger, const std::string& message) :
-    type(type), targetPlayer(player), targetEvent(new InfoEvent(message)),
-    targetTrigger(trigger), toDelete(WhatToDelete::TargetEvent) {}
+    Trigger* const trigger, const UpdateText& message) : type(type),
+    targetPlayer(player), targetTrigger(trigger), message(message) {}
 
 
-GameUpdate::GameUpdate(int type, Event* event, const std::string& message) :
-    type(type), targetEvent(event), targetTrigger(new InfoTrigger(message)),
-    toDelete(WhatToDelete::TargetTrigger) {}
-GameUpdate::GameUpdate(int type, Event* event, const std::string& message,
+GameUpdate::GameUpdate(int type, Event* event, const UpdateText& message) :
+    type(type), targetEvent(event), message(message) {}
+GameUpdate::GameUpdate(int type, Event* event, const UpdateText& message,
     int info) : type(type), info(info), targetEvent(event),
-    targetTrigger(new InfoTrigger(message)),
-    toDelete(WhatToDelete::TargetTrigger) {}
+    message(message) {}
 
 GameUpdate::GameUpdate(int type, Trigger* trigger,
-    const std::string& message) : type(type),
-    targetEvent(new InfoEvent(message)), toDelete(WhatToDelete::TargetEvent) {
+    const UpdateText& message) : type(type), message(message) {
   Player* player = trigger->player();
   if(player) {
     targetPlayer = player;
@@ -112,9 +100,8 @@ GameUpdate::GameUpdate(int type, Trigger* trigger,
     targetTrigger = trigger;
   }
 }
-GameUpdate::GameUpdate(int type, Trigger* trigger, const std::string& message,
-    int info) : type(type), info(info),
-    targetEvent(new InfoEvent(message)), toDelete(WhatToDelete::TargetEvent) {
+GameUpdate::GameUpdate(int type, Trigger* trigger, const UpdateText& message,
+    int info) : type(type), info(info), message(message) {
   Player* player = trigger->player();
   if(player) {
     targetPlayer = player;
@@ -134,7 +121,7 @@ GameUpdate::GameUpdate(const int type, Player* const player,
 GameUpdate::GameUpdate(const GameUpdate& other) : type(other.type),
     info(other.info), targetPlayer(other.targetPlayer),
     targetEvent(other.targetEvent), targetTrigger(other.targetTrigger),
-    toDelete(other.toDelete) {
+    toDelete(other.toDelete), room(other.room), message(other.message) {
   if(toDelete == WhatToDelete::TargetEvent) {
     targetEvent = other.targetEvent->clone();
   }
@@ -157,6 +144,8 @@ GameUpdate& GameUpdate::operator=(const GameUpdate& other) {
     targetEvent = other.targetEvent;
     targetTrigger = other.targetTrigger;
     toDelete = other.toDelete;
+    room = other.room;
+    message = other.message;
 
     if(toDelete == WhatToDelete::TargetEvent) {
       targetEvent = other.targetEvent->clone();
@@ -179,6 +168,15 @@ GameUpdate::~GameUpdate() {
 
 
 
+void* GameUpdate::operator new(const std::size_t size) {
+  return UpdateArena::local().allocate(size);
+}
+void GameUpdate::operator delete(void* const update, const std::size_t size) {
+  UpdateArena::local().deallocate(update, size);
+}
+
+
+
 GameUpdate::operator int() const { return type; }
 int GameUpdate::getType() const { return type; }
 int GameUpdate::getInfo() const { return info; }
@@ -198,19 +196,9 @@ bool GameUpdate::hasTrigger() const {
 }
 
 
-RoomPos GameUpdate::getRoom() const {
-  if(toDelete == WhatToDelete::TargetEvent) {
-    return targetEvent->getLocation();
-  } else if(toDelete == WhatToDelete::TargetTrigger) {
-    return targetTrigger->getLocation();
-  }
-  return NONE;
+const RoomPos& GameUpdate::getRoom() const {
+  return room;
 }
-std::string GameUpdate::getMessage() const {
-  if(toDelete == WhatToDelete::TargetEvent) {
-    return targetEvent->name();
-  } else if(toDelete == WhatToDelete::TargetTrigger) {
-    return targetTrigger->name();
-  }
-  return "";
+std::string_view GameUpdate::getMessage() const {
+  return message.view();
 }
@@ -1,7 +1,10 @@
 #ifndef GAME_UPDATE_HPP
 #define GAME_UPDATE_HPP
 
+#include <cstddef>
+
 #include "htwTypes.hpp"
+#include "updateText.hpp"
 
 class Player;
 class Event;
@@ -17,10 +20,10 @@ public:
     // No additional information needed
     ForceUpdateEnd,
 
-    // targetTrigger: contains text describing the win
+    // message: contains text describing the win
     WinGame,
 
-    // targetTrigger: contains text describing the loss
+    // message: contains text describing the loss
     LoseGame,
     
     // info: The game mode to switch into
@@ -127,6 +130,12 @@ public:
     // targetPlayer: player for the Event to react to
     // message: contains the text name of the event to trigger
     TriggerEvent,
+
+
+  /* Defined by mods */
+    // Mods may number their own update types starting from this value, and
+    // register handlers for them with Cave::setUpdateHandler
+    FirstModUpdate,
   };
   
   enum class WhatToDelete {
@@ -150,6 +159,14 @@ private:
 
   WhatToDelete toDelete = WhatToDelete::Nothing;
 
+  // Payloads stored in the update itself, set by the constructors that take
+  // them. Default to NONE and an empty string.
+  RoomPos room;
+  UpdateText message;
+
+  // Number of pointer objects sharing this update, managed by pointer
+  int references = 0;
+
 public:
   /*
    * Function: Minimal Constructor
@@ -168,14 +185,14 @@ public:
   GameUpdate(int type, int info);
   GameUpdate(int type, Event* event);
   GameUpdate(int type, Trigger* trigger);
-  GameUpdate(int type, const std::string& message);
+  GameUpdate(int type, const UpdateText& message);
 
   /*
    * Functions: Multiple-Member Constructors
    * Description: Initializes a GameUpdate object with a type and two or more
    *    of the members to contain information about how to execute the update.
    */
-  GameUpdate(int type, const std::string& message, int info);
+  GameUpdate(int type, const UpdateText& message, int info);
 
   GameUpdate(int type, Event* event, int info);
   GameUpdate(int type, Event* event, RoomPos room);
@@ -186,15 +203,17 @@ public:
 
   GameUpdate(int type, Player* player, Event* event);
   GameUpdate(int type, Player* player, Event* event, int info);
-  GameUpdate(int type, Player* player, Event* event, const std::string& message);
+  GameUpdate(int type, Player* player, Event* event,
+      const UpdateText& message);
   GameUpdate(int type, Player* player, Trigger* trigger);
   GameUpdate(int type, Player* player, Trigger* trigger, int info);
-  GameUpdate(int type, Player* player, Trigger* trigger, const std::string& message);
+  GameUpdate(int type, Player* player, Trigger* trigger,
+      const UpdateText& message);
 
-  GameUpdate(int type, Event* event, const std::string& message);
-  GameUpdate(int type, Event* event, const std::string& message, int info);
-  GameUpdate(int type, Trigger* trigger, const std::string& message);
-  GameUpdate(int type, Trigger* trigger, const std::string& message, int info);
+  GameUpdate(int type, Event* event, const UpdateText& message);
+  GameUpdate(int type, Event* event, const UpdateText& message, int info);
+  GameUpdate(int type, Trigger* trigger, const UpdateText& message);
+  GameUpdate(int type, Trigger* trigger, const UpdateText& message, int info);
 
   
   /*
@@ -223,6 +242,15 @@ public:
    */
   ~GameUpdate();
 
+  /*
+   * Functions: Allocation Operators
+   * Description: Many GameUpdate objects are created and destroyed every
+   *    turn, so their memory comes from the thread's UpdateArena rather than
+   *    the global heap.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* update, std::size_t size);
+
   /*
    * Functions: Flexible getters
    * Description: Flexible direct access to class members is necessary here
@@ -251,21 +279,22 @@ public:
   
   /*
    * Function: getRoom
-   * Description: Uses toDelete to deduce if a RoomPos object was passed to the
-   *    constructor. If it was, this function returns it.
-   * Returns (RoomPos): Returns the RoomPos object passed to the constructor if
-   *    there was one. Otherwise, returns a RoomPos set to NONE.
+   * Description: Returns the RoomPos object passed to the constructor, if
+   *    there was one.
+   * Returns (RoomPos&): The RoomPos object passed to the constructor if
+   *    there was one. Otherwise, a RoomPos set to NONE.
    */
-  RoomPos getRoom() const;
+  const RoomPos& getRoom() const;
 
   /*
    * Function: getMessage
-   * Description: Uses toDelete to deduce if a message string was passed to the
-   *    constructor. If it was, this function returns it.
-   * Returns (RoomPos): Returns the message string passed to the constructor if
-   *    there was one. Otherwise, returns an empty string.
+   * Description: Returns a view of the message string passed to the
+   *    constructor, if there was one. The view is only valid for as long as
+   *    this GameUpdate exists.
+   * Returns (string_view): The message string passed to the constructor if
+   *    there was one. Otherwise, an empty string.
    */
-  std::string getMessage() const;
+  std::string_view getMessage() const;
 };
 
 #endif
@@ -1,37 +1,50 @@
 #include "gameUpdatePointer.hpp"
 
-// #include <utility>
+#include "updateArena.hpp"
 
 
 void GameUpdate::pointer::incrementReference() {
-  if(refCount) {
-    (*refCount)++;
+  if(ptr) {
+    ptr->references++;
   }
 }
 
 void GameUpdate::pointer::dereference() {
-  if(refCount) {
-    (*refCount)--;
-    if(*refCount < 1) {
+  if(ptr) {
+    ptr->references--;
+    if(ptr->references < 1) {
       delete ptr;
-      delete refCount;
       ptr = nullptr;
-      refCount = nullptr;
     }
   }
 }
 
-GameUpdate::pointer::pointer() : ptr(nullptr), refCount(nullptr),
-    nextUpdate(nullptr) {}
-GameUpdate::pointer::pointer(GameUpdate* update) : ptr(update),
-    refCount(nullptr), nextUpdate(nullptr) {
-  if(ptr) {
-    refCount = new int(1);
+GameUpdate::pointer* GameUpdate::pointer::tail() {
+  pointer* node = this;
+  if(lastUpdate) {
+    node = lastUpdate;
+  }
+  while(node->nextUpdate) {
+    node = node->nextUpdate;
   }
+
+  if(node == this) {
+    lastUpdate = nullptr;
+  } else {
+    lastUpdate = node;
+  }
+  return node;
+}
+
+GameUpdate::pointer::pointer() : ptr(nullptr), nextUpdate(nullptr),
+    lastUpdate(nullptr) {}
+GameUpdate::pointer::pointer(GameUpdate* update) : ptr(update),
+    nextUpdate(nullptr), lastUpdate(nullptr) {
+  incrementReference();
 }
 
 GameUpdate::pointer::pointer(const pointer& other) : ptr(other.ptr),
-    refCount(other.refCount), nextUpdate(other.nextUpdate) {
+    nextUpdate(other.nextUpdate), lastUpdate(other.lastUpdate) {
   incrementReference();
 }
 GameUpdate::pointer& GameUpdate::pointer::operator=(const pointer& other) {
@@ -40,20 +53,20 @@ GameUpdate::pointer& GameUpdate::pointer::operator=(const pointer& other) {
     deleteNext();
 
     ptr = other.ptr;
-    refCount = other.refCount;
     incrementReference();
 
     // Only shallow copy the rest of the list
     nextUpdate = other.nextUpdate;
+    lastUpdate = other.lastUpdate;
   }
   return *this;
 }
 
 GameUpdate::pointer::pointer(pointer&& other) : ptr(other.ptr),
-    refCount(other.refCount), nextUpdate(other.nextUpdate) {
+    nextUpdate(other.nextUpdate), lastUpdate(other.lastUpdate) {
   other.ptr = nullptr;
-  other.refCount = nullptr;
   other.nextUpdate = nullptr;
+  other.lastUpdate = nullptr;
 }
 GameUpdate::pointer& GameUpdate::pointer::operator=(pointer&& other) {
   if(this != &other) {
@@ -61,12 +74,12 @@ GameUpdate::pointer& GameUpdate::pointer::operator=(pointer&& other) {
     deleteNext();
 
     ptr = other.ptr;
-    refCount = other.refCount;
     nextUpdate = other.nextUpdate;
+    lastUpdate = other.lastUpdate;
 
     other.ptr = nullptr;
-    other.refCount = nullptr;
     other.nextUpdate = nullptr;
+    other.lastUpdate = nullptr;
   }
   return *this;
 }
@@ -76,6 +89,14 @@ GameUpdate::pointer::~pointer() {
   // Not deleting nextUpdate!! Must be managed at a higher level.
 }
 
+void* GameUpdate::pointer::operator new(const std::size_t size) {
+  return UpdateArena::local().allocate(size);
+}
+void GameUpdate::pointer::operator delete(void* const node,
+    const std::size_t size) {
+  UpdateArena::local().deallocate(node, size);
+}
+
 GameUpdate& GameUpdate::pointer::operator*() {
   return *ptr;
 }
@@ -106,14 +127,15 @@ GameUpdate::pointer& GameUpdate::pointer::operator++() {
 
   if(nextUpdate) {
     ptr = nextUpdate->ptr;
-    refCount = nextUpdate->refCount;
     incrementReference();
 
+    if(lastUpdate == nextUpdate) {
+      lastUpdate = nullptr;
+    }
     nextUpdate = nextUpdate->nextUpdate;
 
   } else {
     ptr = nullptr;
-    refCount = nullptr;
   }
   return *this;
 }
@@ -127,19 +149,19 @@ void GameUpdate::pointer::moveToNext() {
 
   if(nextUpdate) {
     ptr = nextUpdate->ptr;
-    refCount = nextUpdate->refCount;
     nextUpdate->ptr = nullptr;
-    nextUpdate->refCount = nullptr;
 
     // Have to save nextUpdate to delete it after replacement
     pointer* next = nextUpdate;
     nextUpdate = next->nextUpdate;
+    if(lastUpdate == next) {
+      lastUpdate = nullptr;
+    }
     // next should be set to nullptr, but must free pointer class memory
     delete next;
 
   } else {
     ptr = nullptr;
-    refCount = nullptr;
   }
 }
 
@@ -156,45 +178,61 @@ GameUpdate::pointer* GameUpdate::pointer::nextPointer() {
 
 void GameUpdate::pointer::setNext(const pointer& next) {
   // This will shallow copy the rest of the linked list
-  nextUpdate = new pointer(next);
+  setNext(new pointer(next));
 }
 void GameUpdate::pointer::setNext(pointer* const next) {
   nextUpdate = next;
+  lastUpdate = nullptr;
+  if(next) {
+    lastUpdate = next->tail();
+  }
 }
 
-void GameUpdate::pointer::append(const pointer& update){
-  if(nextUpdate) {
-    nextUpdate->append(update);
-  } else {
-    if(ptr) {
-      setNext(update);
-
-    } else {
-      // This object is empty, so transfer update data
-      ptr = update.ptr;
-      refCount = update.refCount;
-      nextUpdate = update.nextUpdate;
-      incrementReference();
-    }
+void GameUpdate::pointer::append(const pointer& update) {
+  if(!update) {
+    // Nothing to add
+    return;
+  }
+
+  if(!ptr && !nextUpdate) {
+    // This object is empty, so transfer update data
+    ptr = update.ptr;
+    nextUpdate = update.nextUpdate;
+    lastUpdate = update.lastUpdate;
+    incrementReference();
+    return;
   }
+
+  pointer* node = new pointer(update);
+  tail()->nextUpdate = node;
+  lastUpdate = node->tail();
 }
 
 void GameUpdate::pointer::insertNext(const pointer& update) {
-  pointer* next = nextUpdate;
-  nextUpdate = nullptr;
+  if(!update) {
+    // Nothing to insert
+    return;
+  }
 
-  setNext(update);
+  pointer* node = new pointer(update);
+  pointer* insertedTail = node->tail();
+  insertedTail->nextUpdate = nextUpdate;
 
-  if(next) {
-    append(*next);
-    delete next;
+  if(!nextUpdate) {
+    // The inserted updates are now the end of the list
+    lastUpdate = insertedTail;
   }
+  nextUpdate = node;
 }
 
 void GameUpdate::pointer::deleteNext() {
-  if(nextUpdate) {
-    nextUpdate->deleteNext();
-    delete nextUpdate;
-    nextUpdate = nullptr;
+  pointer* node = nextUpdate;
+  nextUpdate = nullptr;
+  lastUpdate = nullptr;
+
+  while(node) {
+    pointer* next = node->nextUpdate;
+    delete node;
+    node = next;
   }
 }
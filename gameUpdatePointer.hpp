@@ -7,8 +7,11 @@
 class GameUpdate::pointer {
 private:
   GameUpdate* ptr;
-  int* refCount;
   pointer* nextUpdate;
+  // The last node in the list when this was last appended to. Only used as a
+  // starting point for finding the tail, so it may fall behind the real tail
+  // when the list is modified through another node.
+  pointer* lastUpdate;
 
   /*
    * Function: incrementReference
@@ -23,6 +26,14 @@ private:
    */
   void dereference();
 
+  /*
+   * Function: tail
+   * Description: Finds the last node in the linked list, starting from the
+   *    cached lastUpdate if there is one, and caches the result.
+   * Returns (pointer*): The last node in the list, which may be this object.
+   */
+  pointer* tail();
+
 public:
   /*
     * Function: Default Constructor
@@ -59,6 +70,14 @@ public:
     */
   ~pointer();
 
+  /*
+   * Functions: Allocation Operators
+   * Description: List nodes are allocated from the thread's UpdateArena,
+   *    the same as the GameUpdate objects they point to.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* node, std::size_t size);
+
   /*
     * Functions: Dereference Operators
     * Description: These functions return a GameUpdate reference for access
@@ -142,7 +161,8 @@ public:
   /*
    * Function: append
    * Description: Adds the given update pointer to the end of the linked list
-   *    of update pointers.
+   *    of update pointers. Uses the cached tail, so appending doesn't walk
+   *    the list.
    * Parameters:
    *    update (pointer): The pointer to the GameUpdate to add.
    */
@@ -151,7 +171,8 @@ public:
   /*
    * Function: insertNext
    * Description: Inserts the given update pointer at the next position of the
-   *    linked list of update pointers.
+   *    linked list of update pointers. Any updates already linked after the
+   *    given pointer are inserted with it, ahead of the rest of this list.
    * Parameters:
    *    update (pointer): The poitner to the GameUpdate to insert
    */
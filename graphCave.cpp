@@ -0,0 +1,83 @@
+#include "graphCave.hpp"
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+
+int GraphCave::tunnelCount(const RoomIndex index) const {
+  return graph.tunnelCount(index);
+}
+
+RoomIndex GraphCave::tunnel(const RoomIndex index, const int slot) const {
+  return graph.tunnel(index, slot);
+}
+
+int GraphCave::continueTunnel(const RoomIndex from, const RoomIndex index,
+    const int slot) const {
+  return graph.continueTunnel(from, index, slot);
+}
+
+std::string GraphCave::getBoard() const {
+  // Rooms are numbered from 1, as in the original game. Each room takes 7
+  // characters while its number fits in 4 columns.
+  std::string board;
+  board.reserve((std::size_t)height * ((std::size_t)width * 7 + 1));
+  RoomIndex index = 0;
+  for(int i = 0; i < height; ++i) {
+    for(int j = 0; j < width; ++j, ++index) {
+      char c = getRoom(index).getChar(gameMode);
+      if(c == (char)NONE) {
+        c = ' ';
+      }
+      char number[16];
+      const std::size_t digits = (std::size_t)(std::to_chars(number,
+          number + sizeof(number), index + 1).ptr - number);
+      if(digits < 4) {
+        board.append(4 - digits, ' ');
+      }
+      board.append(number, digits);
+      board += ": ";
+      board += c;
+    }
+    board += "\n";
+  }
+  return board;
+}
+
+std::string GraphCave::getBoardView(Player*, int) {
+  return getBoard();
+}
+
+std::string GraphCave::getTunnelList(Player* const player) const {
+  const RoomIndex room = toIndex(player->getLocation());
+  std::string tunnels = "You are in room " + std::to_string(room + 1) +
+      ". Tunnels lead to";
+  const int count = graph.tunnelCount(room);
+  for(int i = 0; i < count; ++i) {
+    tunnels += (i == 0 ? " " : ", ") + std::to_string(i + 1) + ": room " +
+        std::to_string(graph.tunnel(room, i) + 1);
+  }
+  return tunnels + "\n";
+}
+
+
+
+GraphCave::GraphCave(const GameSetup* const setup, CaveGraph graph) :
+    BasicCave(setup, true), graph(std::move(graph)) {
+  if(this->graph.roomCount() != height * width) {
+    throw std::invalid_argument("The cave graph has " +
+        std::to_string(this->graph.roomCount()) + " rooms, but the board has " +
+        std::to_string(height * width) + ".");
+  }
+  addSetupEvents(setup);
+}
+
+std::string GraphCave::turnDisplay(Player* const active) {
+  std::string output = BasicCave::turnDisplay(active);
+  if(active) {
+    output += getTunnelList(active);
+  }
+  return output;
+}
@@ -0,0 +1,85 @@
+#ifndef GRAPH_CAVE_HPP
+#define GRAPH_CAVE_HPP
+
+#include "caveGraph.hpp"
+#include "caveImpl.hpp"
+
+
+// A BasicCave whose rooms are joined by the tunnels of a graph instead of a
+// grid, such as the dodecahedron of the original game. The setup's height and
+// width are only used to number the rooms, so their product must match the
+// number of rooms in the graph.
+class GraphCave : public BasicCave {
+protected:
+  CaveGraph graph;
+
+  /*
+   * Function(s): tunnelCount/tunnel
+   * Description: Follow the tunnels of the graph. See BasicCave.
+   */
+  int tunnelCount(RoomIndex index) const override;
+  RoomIndex tunnel(RoomIndex index, int slot) const override;
+
+  /*
+   * Function: continueTunnel
+   * Description: Takes one of the tunnels that doesn't lead back, since the
+   *    same slot leads somewhere different in each room. See
+   *    CaveGraph::continueTunnel.
+   */
+  int continueTunnel(RoomIndex from, RoomIndex index, int slot) const override;
+
+  /*
+   * Function: getBoard
+   * Description: Returns a list of the rooms in the cave, with the character
+   *    of each room beside its number.
+   * Returns (string): A textual representation of the rooms.
+   */
+  std::string getBoard() const override;
+
+  /*
+   * Function: getBoardView
+   * Description: Returns the list of rooms from getBoard. The rooms aren't in
+   *    a grid, so there is no window to centre on the player.
+   * Parameters:
+   *    active (Player*): Unused.
+   *    panelWidth (int): Unused.
+   * Returns (string): A textual representation of the rooms.
+   */
+  std::string getBoardView(Player* active, int panelWidth) override;
+
+  /*
+   * Function: getTunnelList
+   * Description: Returns the rooms the tunnels out of the player's room lead
+   *    to, along with the key to press for each.
+   * Parameters:
+   *    player (Player*): The player to list the tunnels for.
+   * Returns (string): A line listing each tunnel.
+   */
+  std::string getTunnelList(Player* player) const;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Creates the cave from the setup, joining its rooms with the
+   *    tunnels of the given graph.
+   * Parameters:
+   *    setup (GameSetup*): Contains setup variables and events to use to
+   *      create the cave.
+   *    graph (CaveGraph): The tunnels between the rooms.
+   * Effects: Throws std::invalid_argument if the graph doesn't have one room
+   *    for each room of the setup's board.
+   */
+  GraphCave(const GameSetup* setup, CaveGraph graph);
+
+  /*
+   * Function: turnDisplay
+   * Description: Returns the string to display at the start of each turn,
+   *    like BasicCave, followed by the tunnels the player can take.
+   * Parameters:
+   *    active (Player*): The player whose turn it is.
+   * Returns (string): The text to display.
+   */
+  std::string turnDisplay(Player* active) override;
+};
+
+#endif
@@ -43,6 +43,11 @@ enum Actions {
 };
 
 
+// The position of a room in a row-major array of the rooms on the board,
+// equal to row * width + col.
+typedef int RoomIndex;
+
+
 // Stores the location of a room on the board.
 struct RoomPos {
   int row;
@@ -117,4 +122,10 @@ enum GameModeTypes {
   DebugMode,
 };
 
+// The layouts the rooms of the cave can be joined in.
+enum CaveTopologies {
+  GridTopology,
+  DodecahedronTopology,
+};
+
 #endif
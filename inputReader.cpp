@@ -0,0 +1,52 @@
+#include "inputReader.hpp"
+
+#include "ioSpDef.hpp"
+
+
+
+void InputReader::readLoop() {
+  while(!stopping) {
+    int key = getchTimeout(pollMs);
+    if(key == NO_KEY_PRESSED) {
+      continue;
+    }
+    if(key == INPUT_CLOSED) {
+      closed = true;
+    } else if(!keys.push(key)) {
+      // The player typed further ahead than the queue holds
+      continue;
+    }
+
+    // Take the lock so the game can't miss the wake up between checking the
+    // queue and going to sleep
+    {
+      std::lock_guard<std::mutex> guard(sleepLock);
+    }
+    keyQueued.notify_one();
+    if(closed) {
+      return;
+    }
+  }
+}
+
+InputReader::InputReader() : stopping(false), closed(false) {
+  reader = std::thread(&InputReader::readLoop, this);
+}
+
+InputReader::~InputReader() {
+  stopping = true;
+  reader.join();
+}
+
+int InputReader::nextKey() {
+  int key;
+  if(keys.pop(key)) {
+    return key;
+  }
+  std::unique_lock<std::mutex> guard(sleepLock);
+  keyQueued.wait(guard, [this] { return !keys.empty() || closed; });
+  if(keys.pop(key)) {
+    return key;
+  }
+  return NO_KEY_PRESSED;
+}
@@ -0,0 +1,67 @@
+#ifndef INPUT_READER_HPP
+#define INPUT_READER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "keyQueue.hpp"
+
+
+// Reads key presses on a thread of its own and queues them for the game, so
+// keys pressed while a turn is resolving are kept (type-ahead), and the game
+// only waits when it needs a key that hasn't been pressed yet. The reading
+// thread never touches curses, so it can run while the game draws.
+class InputReader {
+private:
+  KeyQueue keys;
+  std::thread reader;
+  std::atomic<bool> stopping;
+  // Set once standard input has ended and no more keys will be queued
+  std::atomic<bool> closed;
+
+  // Wakes the game when a key is queued while it is waiting
+  std::mutex sleepLock;
+  std::condition_variable keyQueued;
+
+  /*
+   * Function: readLoop
+   * Description: Queues each key pressed until the reader is destroyed or
+   *    standard input ends, checking for the reader being destroyed every
+   *    pollMs milliseconds.
+   */
+  void readLoop();
+
+public:
+  // How often the reading thread checks whether it should stop
+  static constexpr int pollMs = 50;
+
+  /*
+   * Function: Constructor
+   * Description: Starts the reading thread. The terminal should already be
+   *    set up to send each key as it is pressed (CURSES_INIT).
+   */
+  InputReader();
+
+  InputReader(const InputReader&) = delete;
+  InputReader& operator=(const InputReader&) = delete;
+
+  /*
+   * Function: Destructor
+   * Description: Stops the reading thread and waits for it to finish, which
+   *    takes up to pollMs milliseconds. Keys still queued are discarded.
+   */
+  ~InputReader();
+
+  /*
+   * Function: nextKey
+   * Description: Takes the oldest key pressed, waiting for one if none are
+   *    queued.
+   * Returns (int): The key, in the form returned by getchEsc(), or
+   *    NO_KEY_PRESSED if standard input has ended.
+   */
+  int nextKey();
+};
+
+#endif
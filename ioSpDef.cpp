@@ -1,9 +1,178 @@
 #include "ioSpDef.hpp"
 
+#include <cstdio>
+
+#ifdef __linux__
+  #include <csignal>
+  #include <poll.h>
+  #include <sys/ioctl.h>
+  #include <termios.h>
+  #include <unistd.h>
+#else
+  #include <chrono>
+  #include <thread>
+#endif
+
 int getchEsc() {
+#if defined(__linux__) && defined(NO_CURSES)
+  int key;
+  do {
+    key = getchTimeout(-1);
+  } while(key == NO_KEY_PRESSED);
+  return key == INPUT_CLOSED ? NO_KEY_PRESSED : key;
+#else
   int key = getch();
   if(key == GETCH_ESC) {
     key = GETCH_ESC * getch();
   }
   return key;
+#endif
+}
+
+#ifdef __linux__
+// How long to wait for the rest of an escape sequence before treating the
+// escape key as pressed on its own
+static constexpr int escapeDelayMs = 25;
+
+// A byte read while looking for an escape sequence that wasn't part of one,
+// to be returned by the next read
+static int pending = NO_KEY_PRESSED;
+
+/*
+ * Function: readByte
+ * Description: Waits up to the given time for a byte of standard input.
+ * Parameters:
+ *    timeoutMs (int): The most milliseconds to wait.
+ * Returns (int): The byte, NO_KEY_PRESSED, or INPUT_CLOSED.
+ */
+static int readByte(const int timeoutMs) {
+  if(pending != NO_KEY_PRESSED) {
+    int byte = pending;
+    pending = NO_KEY_PRESSED;
+    return byte;
+  }
+  struct pollfd input = { STDIN_FILENO, POLLIN, 0 };
+  if(poll(&input, 1, timeoutMs) <= 0) {
+    return NO_KEY_PRESSED;
+  }
+  unsigned char byte;
+  if(read(STDIN_FILENO, &byte, 1) != 1) {
+    return INPUT_CLOSED;
+  }
+  return byte;
+}
+#endif
+
+int getchTimeout(const int timeoutMs) {
+#ifdef __linux__
+  constexpr int escape = 27;
+  int key = readByte(timeoutMs);
+  if(key != escape) {
+    return key;
+  }
+
+  // Arrow keys arrive as ESC [ A, or ESC O A in keypad mode
+  int next = readByte(escapeDelayMs);
+  if(next != '[' && next != 'O') {
+    if(next >= 0) {
+      pending = next;
+    }
+    return escape;
+  }
+  int code = readByte(escapeDelayMs);
+  switch(code) {
+    case 'A':
+      return KEY_UP;
+    case 'B':
+      return KEY_DOWN;
+    case 'C':
+      return KEY_RIGHT;
+    case 'D':
+      return KEY_LEFT;
+  }
+  // Skip the rest of any other sequence, up to its final byte
+  while(code >= 0 && !(code >= '@' && code <= '~')) {
+    code = readByte(escapeDelayMs);
+  }
+  return code == INPUT_CLOSED ? INPUT_CLOSED : NO_KEY_PRESSED;
+#else
+  constexpr int pollMs = 10;
+  for(int waited = 0; !_kbhit(); waited += pollMs) {
+    if(waited >= timeoutMs) {
+      return NO_KEY_PRESSED;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(pollMs));
+  }
+  return getchEsc();
+#endif
+}
+
+#ifdef __linux__
+// The terminal's settings from before startRawTerminal, and whether they need
+// to be restored
+static struct termios savedMode;
+static volatile std::sig_atomic_t rawTerminal = 0;
+
+static constexpr char enterScreen[] = "\x1b[?1049h\x1b[H\x1b[2J";
+static constexpr char leaveScreen[] = "\x1b[?1049l";
+
+// Puts the terminal back before the program is stopped by a signal. Only uses
+// functions that are safe to call from a signal handler.
+static void restoreTerminal(const int signal) {
+  if(rawTerminal) {
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, &savedMode);
+    ssize_t written = write(STDOUT_FILENO, leaveScreen,
+        sizeof(leaveScreen) - 1);
+    (void)written;
+  }
+  std::signal(signal, SIG_DFL);
+  std::raise(signal);
+}
+#endif
+
+void startRawTerminal() {
+#ifdef __linux__
+  if(rawTerminal || tcgetattr(STDIN_FILENO, &savedMode) != 0) {
+    return;
+  }
+  // Keep the signal keys (Ctrl+C) and output processing (\n to \r\n), as
+  // curses' cbreak mode does
+  struct termios raw = savedMode;
+  raw.c_lflag &= ~(ICANON | ECHO | IEXTEN);
+  raw.c_cc[VMIN] = 1;
+  raw.c_cc[VTIME] = 0;
+  tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+  rawTerminal = 1;
+
+  std::signal(SIGINT, restoreTerminal);
+  std::signal(SIGTERM, restoreTerminal);
+  std::signal(SIGQUIT, restoreTerminal);
+  std::fputs(enterScreen, stdout);
+  std::fflush(stdout);
+#endif
+}
+
+void endRawTerminal() {
+#ifdef __linux__
+  if(!rawTerminal) {
+    return;
+  }
+  std::fputs(leaveScreen, stdout);
+  std::fflush(stdout);
+  tcsetattr(STDIN_FILENO, TCSAFLUSH, &savedMode);
+  rawTerminal = 0;
+  std::signal(SIGINT, SIG_DFL);
+  std::signal(SIGTERM, SIG_DFL);
+  std::signal(SIGQUIT, SIG_DFL);
+#endif
+}
+
+void updateScreenSize() {
+#if defined(__linux__) && !defined(NO_CURSES)
+  struct winsize size;
+  if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0 &&
+      size.ws_col > 0 && (size.ws_row != LINES || size.ws_col != COLS)) {
+    resizeterm(size.ws_row, size.ws_col);
+  }
+#endif
 }
@@ -1,19 +1,49 @@
 /*
  * Header file that provides operating system specific definitions for IO
- * functions, for clearing the terminal and getting key presses.
+ * functions, for drawing text, clearing the terminal and getting key presses.
  */
 
 #ifndef IO_SP_DEF_HPP
 #define IO_SP_DEF_HPP
 
-#ifdef __linux__
+#if defined(__linux__) && !defined(NO_CURSES)
   #include <curses.h>
 
   #define CURSES_INIT initscr(); cbreak(); noecho(); keypad(stdscr, TRUE)
   #define CURSES_END endwin(); exit_curses(0)
   #define CLEAR_SCREEN wclear(stdscr)
 
-  #define print(str) wprintw(stdscr, ((std::string)str).c_str()); wrefresh(stdscr)
+  // Text is drawn to curses' copy of the screen, which is only sent to the
+  // terminal when it is refreshed
+  #define PRINT_TEXT(str, length) waddnstr(stdscr, str, length)
+  #define REFRESH_SCREEN wrefresh(stdscr)
+
+  // Cursor positioning, so part of the screen can be redrawn in place
+  #define CURSOR_CONTROL
+  #define SCREEN_SIZE(rows, cols) getmaxyx(stdscr, rows, cols)
+  #define MOVE_CURSOR(row, col) wmove(stdscr, row, col)
+  #define CLEAR_TO_LINE_END wclrtoeol(stdscr)
+  #define CLEAR_TO_BOTTOM wclrtobot(stdscr)
+
+  #define GETCH_ESC 224
+
+#elif defined(__linux__)
+  // Built without curses (make CURSES=0), so the terminal is only driven with
+  // termios and ANSI escape codes
+  #include <cstdio>
+
+  #define CURSES_INIT startRawTerminal()
+  #define CURSES_END endRawTerminal()
+  #define CLEAR_SCREEN std::fputs("\x1b[H\x1b[2J", stdout)
+
+  #define PRINT_TEXT(str, length) std::fwrite(str, 1, length, stdout)
+  #define REFRESH_SCREEN std::fflush(stdout)
+
+  // The codes curses gives the arrow keys, for mods that check for them
+  #define KEY_DOWN 0402
+  #define KEY_UP 0403
+  #define KEY_LEFT 0404
+  #define KEY_RIGHT 0405
 
   #define GETCH_ESC 224
 
@@ -24,7 +54,8 @@
   #define CURSES_END
   #define CLEAR_SCREEN system("CLS")
 
-  #define print(str) std::cout << str;
+  #define PRINT_TEXT(str, length) std::cout.write(str, length)
+  #define REFRESH_SCREEN std::cout.flush()
 
   #define GETCH_ESC 224
   #define KEY_UP GETCH_ESC * 72
@@ -34,6 +65,11 @@
 
 #endif
 
+// Returned by getchTimeout when no key was pressed in time, or when there is
+// no more input to read
+#define NO_KEY_PRESSED (-1)
+#define INPUT_CLOSED (-2)
+
 /*
  * Function: getchEsc
  * Description: If the escape sequence is detected, queries getch() again for
@@ -43,4 +79,39 @@
  */
 int getchEsc();
 
+/*
+ * Function: getchTimeout
+ * Description: Waits up to the given time for a key press, without using
+ *    curses, so it can be called from a thread other than the one drawing the
+ *    screen. On Linux, the bytes of the terminal's arrow key sequences are
+ *    decoded into the curses KEY_UP, KEY_DOWN, KEY_LEFT and KEY_RIGHT codes,
+ *    as getch() returns them. Other escape sequences are skipped. Should only
+ *    be called from one thread.
+ * Parameters:
+ *    timeoutMs (int): The most milliseconds to wait.
+ * Returns (int): The key pressed in the form returned by getchEsc(),
+ *    NO_KEY_PRESSED if none was pressed in time, or INPUT_CLOSED if standard
+ *    input has ended.
+ */
+int getchTimeout(int timeoutMs);
+
+/*
+ * Function(s): startRawTerminal, endRawTerminal
+ * Description: Start and end a session on the terminal without curses.
+ *    Starting turns off line buffering and echoing with termios, so each key
+ *    is sent as it is pressed, and switches to the terminal's alternate
+ *    screen. Ending restores the terminal as it was, which also happens if
+ *    the program is interrupted. Do nothing on Windows, where getch() already
+ *    reads single keys.
+ */
+void startRawTerminal();
+void endRawTerminal();
+
+/*
+ * Function: updateScreenSize
+ * Description: Tells curses if the terminal has been resized, which it would
+ *    otherwise only notice while waiting in getch().
+ */
+void updateScreenSize();
+
 #endif
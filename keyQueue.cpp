@@ -0,0 +1,30 @@
+#include "keyQueue.hpp"
+
+
+
+KeyQueue::KeyQueue() : keys(), head(0), tail(0) {}
+
+bool KeyQueue::push(const int key) {
+  const std::size_t back = tail.load(std::memory_order_relaxed);
+  if(back - head.load(std::memory_order_acquire) == capacity) {
+    return false;
+  }
+  keys[back & (capacity - 1)] = key;
+  tail.store(back + 1, std::memory_order_release);
+  return true;
+}
+
+bool KeyQueue::pop(int& key) {
+  const std::size_t front = head.load(std::memory_order_relaxed);
+  if(front == tail.load(std::memory_order_acquire)) {
+    return false;
+  }
+  key = keys[front & (capacity - 1)];
+  head.store(front + 1, std::memory_order_release);
+  return true;
+}
+
+bool KeyQueue::empty() const {
+  return head.load(std::memory_order_acquire) ==
+      tail.load(std::memory_order_acquire);
+}
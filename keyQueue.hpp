@@ -0,0 +1,64 @@
+#ifndef KEY_QUEUE_HPP
+#define KEY_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+
+// A fixed size queue of key presses passed from one thread to another without
+// locking. Only one thread may push and only one other thread may pop. Each
+// side only writes its own end of the queue, and publishes it with a release
+// store that the other side reads with an acquire load.
+class KeyQueue {
+public:
+  // Keys a player can type ahead before more are dropped. A power of two, so
+  // positions wrap with a mask.
+  static constexpr std::size_t capacity = 256;
+
+private:
+  std::array<int, capacity> keys;
+  // The number of keys ever popped and pushed. Their difference is the number
+  // of keys waiting.
+  std::atomic<std::size_t> head;
+  std::atomic<std::size_t> tail;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Creates an empty queue.
+   */
+  KeyQueue();
+
+  KeyQueue(const KeyQueue&) = delete;
+  KeyQueue& operator=(const KeyQueue&) = delete;
+
+  /*
+   * Function: push
+   * Description: Adds a key to the back of the queue. Only called by the
+   *    producing thread.
+   * Parameters:
+   *    key (int): The key to add.
+   * Returns (bool): False if the queue was full, and the key was dropped.
+   */
+  bool push(int key);
+
+  /*
+   * Function: pop
+   * Description: Takes the key at the front of the queue. Only called by the
+   *    consuming thread.
+   * Parameters:
+   *    key (int&): Set to the key taken, if there was one.
+   * Returns (bool): False if the queue was empty.
+   */
+  bool pop(int& key);
+
+  /*
+   * Function: empty
+   * Returns (bool): True if no keys are waiting. May be out of date as soon as
+   *    it returns, if the other thread is using the queue.
+   */
+  bool empty() const;
+};
+
+#endif
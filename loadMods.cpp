@@ -6,6 +6,8 @@
 #include "gameSetupImpl.hpp"
 #include "playerImpl.hpp"
 #include "caveImpl.hpp"
+#include "graphCave.hpp"
+#include "sparseCave.hpp"
 
 
 
@@ -46,9 +48,21 @@ void LoadMods::loadSetup() {
   if(!setup) {
     setup = new BasicSetup(defaultEvent);
   }
+  setup->getRandom().setStream(randomStream);
   
-  // Ask user for setup configurations
-  setup->promptConfigurations();
+  // Ask user for setup configurations, unless they were already given or
+  // come from a snapshot
+  if(setupVars.empty() && !snapshot) {
+    setup->promptConfigurations();
+  } else if(setupVars.empty()) {
+    setup->setSetupVar(GameSetup::GameMode, NormalMode);
+  }
+  for(const auto& [type, value] : setupVars) {
+    setup->setSetupVar(type, value);
+  }
+  if(snapshot) {
+    snapshot->configure(setup);
+  }
 }
 
 void LoadMods::loadPlayers() {
@@ -112,8 +126,12 @@ void LoadMods::loadEvents() {
   for(Event*& ev : events) {
     setup->addEvent(ev);
   }
-  // Initialize setup with relevant values
-  setup->init();
+  // Initialize setup with relevant values, or the snapshot's placements
+  if(snapshot) {
+    snapshot->place(setup);
+  } else {
+    setup->init();
+  }
 }
 
 void LoadMods::loadCave() {
@@ -132,21 +150,54 @@ void LoadMods::loadCave() {
   }
   
   if(!cave) {
-    cave = new BasicCave(setup);
+    // Very large caves are mostly empty, so only store their occupied rooms
+    const int rooms = setup->getSetupVar(GameSetup::Height) *
+        setup->getSetupVar(GameSetup::Width);
+    if(setup->getSetupVar(GameSetup::Topology) == DodecahedronTopology) {
+      cave = new GraphCave(setup, CaveGraph::dodecahedron());
+    } else if(rooms > SparseCave::minRooms) {
+      cave = new SparseCave(setup);
+    } else {
+      cave = new BasicCave(setup);
+    }
   }
   setup->clearEvents();
 }
 
+void LoadMods::loadUpdateHandlers() {
+  // Unlike the other objects, any number of mods may add update handlers
+  for(HANDLE_TYPE& h : handles) {
+    void (*addHandlers)(Cave*) = nullptr;
+    addHandlers = reinterpret_cast<void (*)(Cave*)>(
+      GetFunctionPointer(h, GET_UPDATE_HANDLERS));
+    if(addHandlers) {
+      addHandlers(cave);
+      std::cout << "Update Handlers Mod Loaded." << std::endl;
+    }
+  }
+}
 
 
-LoadMods::LoadMods() : defaultEvent(nullptr), setup(nullptr), cave(nullptr) {}
+
+LoadMods::LoadMods() : defaultEvent(nullptr), setup(nullptr), cave(nullptr),
+    randomStream(nullptr), snapshot(nullptr) {}
 
 LoadMods::LoadMods(const std::string& dir) : defaultEvent(nullptr),
-    setup(nullptr), cave(nullptr) {
+    setup(nullptr), cave(nullptr), randomStream(nullptr), snapshot(nullptr) {
   loadModHandles(dir);
   loadObjs();
 }
 
+LoadMods::LoadMods(const std::string& dir,
+    const std::map<int, int>& setupVars) : defaultEvent(nullptr),
+    setup(nullptr), cave(nullptr), setupVars(setupVars),
+    randomStream(nullptr), snapshot(nullptr) {
+  if(!dir.empty()) {
+    loadModHandles(dir);
+  }
+  loadObjs();
+}
+
 LoadMods::~LoadMods() {
   delete defaultEvent;
   delete setup;
@@ -164,6 +215,18 @@ Cave* LoadMods::getCave() {
   return cave;
 }
 
+void LoadMods::setSetupVars(const std::map<int, int>& vars) {
+  setupVars = vars;
+}
+
+void LoadMods::setRandomStream(RandomStream* const stream) {
+  randomStream = stream;
+}
+
+void LoadMods::setSnapshot(const CaveSnapshot* const cave) {
+  snapshot = cave;
+}
+
 void LoadMods::loadModHandles(const std::string& dir) {
   std::filesystem::directory_iterator modFiles(dir);
 
@@ -198,4 +261,7 @@ void LoadMods::loadObjs() {
 
   // Use setup to initialize Cave
   loadCave();
+
+  // Register mod update handlers with the finished Cave
+  loadUpdateHandlers();
 }
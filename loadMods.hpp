@@ -7,14 +7,17 @@
  *    Event* getEvent(const GameSetup*)
  *    std::vector<Event*> getEvents(const GameSetup*)
  *    Cave* getCave(const GameSetup*)
+ *    void addUpdateHandlers(Cave*)
  */
 
 #include <vector>
+#include <map>
 #include <filesystem>
 
 #include "dlSpDef.hpp"
 #include "gameSetup.hpp"
 #include "cave.hpp"
+#include "caveSnapshot.hpp"
 
 #include <iostream>
 
@@ -37,6 +40,9 @@
 #define GET_CAVE "getCave"
 #define GET_CAVE_FUNC Cave* getCave(const GameSetup* setup)
 
+#define GET_UPDATE_HANDLERS "addUpdateHandlers"
+#define GET_UPDATE_HANDLERS_FUNC void addUpdateHandlers(Cave* cave)
+
 class LoadMods {
 private:
   std::vector<HANDLE_TYPE> handles;
@@ -45,6 +51,13 @@ private:
   GameSetup* setup;
   Cave* cave;
 
+  // Setup variables to use instead of prompting the user, if not empty
+  std::map<int, int> setupVars;
+  // Passed to the setup's random number generator, if not null
+  RandomStream* randomStream;
+  // Places the events and players instead of the setup, if not null
+  const CaveSnapshot* snapshot;
+
   /*
    * Function(s): Load [object]
    * Description: Attempt to locate functions with specific names for loading
@@ -57,6 +70,7 @@ private:
   void loadPlayers();
   void loadEvents();
   void loadCave();
+  void loadUpdateHandlers();
 
 public:
   /*
@@ -71,6 +85,18 @@ public:
    * Effects: Loads the mods in the given directory.
    */
   LoadMods(const std::string& dir);
+  /*
+   * Function: Constructor
+   * Description: Loads the mods in the given directory like the constructor
+   *    above, but sets up the game with the given setup variables instead of
+   *    prompting the user for them. Used to set up games without a terminal.
+   * Parameters:
+   *    dir (string): The mod directory. If empty, no mods are loaded.
+   *    setupVars (map<int, int>): The value of each setup variable, keyed by
+   *      the types passed to GameSetup::setSetupVar().
+   * Effects: Loads the mods in the given directory.
+   */
+  LoadMods(const std::string& dir, const std::map<int, int>& setupVars);
 
   /*
    * The class has internal pointers and no reasonable way or reason to copy
@@ -104,6 +130,37 @@ public:
    */
   Cave* getCave();
 
+  /*
+   * Function: setSetupVars
+   * Description: Sets the setup variables to give the GameSetup object
+   *    instead of prompting the user for them. Must be called before loadObjs.
+   * Parameters:
+   *    vars (map<int, int>): The value of each setup variable, keyed by the
+   *      types passed to GameSetup::setSetupVar().
+   */
+  void setSetupVars(const std::map<int, int>& vars);
+
+  /*
+   * Function: setRandomStream
+   * Description: Sets the stream that every random number drawn during the
+   *    game passes through. Must be called before loadObjs.
+   * Parameters:
+   *    stream (RandomStream*): The stream, which must outlive this object.
+   */
+  void setRandomStream(RandomStream* stream);
+
+  /*
+   * Function: setSnapshot
+   * Description: Sets the snapshot that gives the size of the cave and places
+   *    its events and players, instead of prompting the user for the size and
+   *    calling GameSetup::init(). Setup variables that are given are still
+   *    set, except the ones for the size of the cave. Must be called before
+   *    loadObjs.
+   * Parameters:
+   *    cave (CaveSnapshot*): The snapshot, which must outlive this object.
+   */
+  void setSnapshot(const CaveSnapshot* cave);
+
   /*
    * Function: loadModHandles
    * Description: Searches the given directory for shared object files, then
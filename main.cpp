@@ -8,31 +8,148 @@
  *    finds the gold and escapes the cave, or kills the Wumpus, then they win.
  *    The game also comes with a mod loader, which can add a wide variety of
  *    features to the base game.
+ *
+ *    Usage: wumpus [--record FILE | --replay FILE] [--cave FILE]
+ *        [--save-cave FILE] [--ansi]
+ *      --record FILE: Saves the game's setup, key presses, and random numbers
+ *        to the file, so it can be replayed later.
+ *      --replay FILE: Plays a recorded game again without a terminal, then
+ *        prints the final board. A game played in a saved cave must be
+ *        replayed with the same --cave.
+ *      --cave FILE: Plays in a cave saved with --save-cave instead of
+ *        choosing the cave's size and placing its events randomly.
+ *      --save-cave FILE: Saves the cave once it is set up, so it can be
+ *        played again with --cave.
+ *      --ansi: Drives the terminal with termios and ANSI escape codes instead
+ *        of curses. Building with `make CURSES=0` always does this, without
+ *        linking ncurses.
  */
 
 #include <iostream>
 #include <filesystem>
+#include <stdexcept>
+#include <string>
 
+#include "caveImpl.hpp"
+#include "caveSnapshot.hpp"
 #include "game.hpp"
+#include "gameIOImpl.hpp"
+#include "gameRecord.hpp"
 #include "loadMods.hpp"
 
 #define MOD_DIR "mods"
 
 
-int main()
+/*
+ * Function: replayGame
+ * Description: Plays a recorded game without a terminal, then prints the
+ *    last screen displayed.
+ * Parameters:
+ *    mods (LoadMods&): Mods loaded with the record's setup and random numbers.
+ *    record (GameRecord&): The loaded record.
+ * Returns (int): The program exit code.
+ */
+static int replayGame(LoadMods& mods, GameRecord& record) {
+  ScriptedIO output(std::vector<int>(), true);
+  RecordIO io(&output, &record);
+  {
+    Game g(mods.getSetup(), mods.getCave(), &io);
+    io.display("Setup Complete. Press any key to begin...");
+    io.getKey();
+    g.playGame();
+    std::cout << "Replayed " << g.getTurnCount() << " turns." << std::endl;
+  }
+
+  // Only show what was on the screen at the end of the game
+  const std::string& text = output.getOutput();
+  std::size_t lastClear = text.rfind('\f');
+  std::cout << text.substr(lastClear == std::string::npos ? 0 : lastClear + 1);
+  return 0;
+}
+
+/*
+ * Function: saveCave
+ * Description: Saves a snapshot of the cave, including the rooms the players
+ *    start in, so it can be loaded with --cave.
+ * Parameters:
+ *    cave (Cave*): The set up cave, after the game has added its players.
+ *    path (string): The file to save to.
+ * Effects: Throws std::runtime_error if the cave doesn't support snapshots
+ *    or the file can't be written.
+ */
+static void saveCave(const Cave* cave, const std::string& path) {
+  const BasicCave* basic = dynamic_cast<const BasicCave*>(cave);
+  if(!basic) {
+    throw std::runtime_error("The cave from the mods can't be saved.");
+  }
+  basic->getSnapshot().save(path);
+}
+
+
+int main(int argc, char** argv)
 {
+  GameRecord record;
+  CaveSnapshot snapshot;
+  bool loadCave = false;
+  std::string saveCavePath;
+  TerminalIO::Backend backend = TerminalIO::defaultBackend;
+  for(int i = 1; i < argc; ++i) {
+    std::string option = argv[i];
+    if(i + 1 < argc && option == "--record") {
+      record.startRecording(argv[++i]);
+    } else if(i + 1 < argc && option == "--replay") {
+      record.load(argv[++i]);
+    } else if(i + 1 < argc && option == "--cave") {
+      snapshot.load(argv[++i]);
+      loadCave = true;
+    } else if(i + 1 < argc && option == "--save-cave") {
+      saveCavePath = argv[++i];
+    } else if(option == "--ansi") {
+      backend = TerminalIO::AnsiBackend;
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--record FILE | --replay FILE]"
+          " [--cave FILE] [--save-cave FILE] [--ansi]" << std::endl;
+      return 1;
+    }
+  }
+
   // Load mods from the mod directory
-  LoadMods mods(MOD_DIR);
+  LoadMods mods;
+  if(record.replaying()) {
+    mods.setSetupVars(record.getSetupVars());
+  }
+  if(loadCave) {
+    mods.setSnapshot(&snapshot);
+  }
+  mods.setRandomStream(&record);
+  mods.loadModHandles(MOD_DIR);
+  mods.loadObjs();
 
   // Get the GameSetup and Cave objects
   GameSetup* setup = mods.getSetup();
   Cave* cave = mods.getCave();
+  record.recordSetup(setup);
+
+  if(record.replaying()) {
+    return replayGame(mods, record);
+  }
+
+  // Start the terminal display, then pause and wait for key press
+  TerminalIO terminal(backend);
+  RecordIO io(&terminal, &record);
+  io.display("Setup Complete. Press any key to begin...");
+  io.getKey();
 
   // Construct Game object
-  Game g(setup, cave);
+  Game g(setup, cave, &io);
+  if(!saveCavePath.empty()) {
+    saveCave(cave, saveCavePath);
+  }
 
   //Play the game
   g.playGame();
+  // Closing the terminal ends the program, so save the end of the record now
+  record.flush();
 
   return 0;
 }
@@ -81,6 +81,18 @@ int MultiplayerSetup::getSetupVar(const int type) const {
   return BasicSetup::getSetupVar(type);
 }
 
+void MultiplayerSetup::setSetupVar(const int type, const int value) {
+  if(type == numPlayerSetupIndex) {
+    numPlayers = value;
+    return;
+  }
+  BasicSetup::setSetupVar(type, value);
+}
+
+int MultiplayerSetup::setupVarCount() const {
+  return numPlayerSetupIndex + 1;
+}
+
 
 
 GET_GAME_SETUP_FUNC {
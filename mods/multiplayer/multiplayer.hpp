@@ -57,7 +57,7 @@ public:
 class MultiplayerSetup : public BasicSetup {
 public:
   static constexpr int maxPlayers = 5;
-  static constexpr int numPlayerSetupIndex = 4;
+  static constexpr int numPlayerSetupIndex = GameSetup::SetupVariableCount;
 
 private:
   int numPlayers;
@@ -68,6 +68,8 @@ public:
   void promptConfigurations() override;
 
   int getSetupVar(int type) const override;
+  void setSetupVar(int type, int value) override;
+  int setupVarCount() const override;
 };
 
 
@@ -26,8 +26,7 @@ std::string BabyWumpus::getPercept(int) const {
 GameUpdate::pointer BabyWumpus::triggerUpdate(Trigger* trigger) {
   Player* player = trigger->player();
   if(player) {
-    double p = (double)rand() / (double)RAND_MAX;
-    if(p < killChance) {
+    if(random->chance(killChance)) {
       return new GameUpdate(GameUpdate::LoseGame,
           "You've been eaten by a baby Wumpus!");
     }
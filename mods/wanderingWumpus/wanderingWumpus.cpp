@@ -34,6 +34,10 @@ GameUpdate::pointer WanderingWumpus::turnUpdate(Player* const active,
   return update;
 }
 
+bool WanderingWumpus::receivesTurnUpdates() const {
+  return true;
+}
+
 
 Event* getEvent(const GameSetup* setup) {
   return new WanderingWumpus(setup->getDefaultEvent());
@@ -42,6 +42,13 @@ public:
    *    player.
    */
   GameUpdate::pointer turnUpdate(Player* active, bool round) override;
+
+  /*
+   * Function: receivesTurnUpdates
+   * Description: Subscribes the Wumpus to turn updates so it can wander.
+   * Returns (bool): True.
+   */
+  bool receivesTurnUpdates() const override;
 };
 
 
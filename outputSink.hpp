@@ -0,0 +1,78 @@
+#ifndef OUTPUT_SINK_HPP
+#define OUTPUT_SINK_HPP
+
+#include <string_view>
+
+
+/*
+ * Where the game's text is drawn. Text written to a sink is held until the
+ *    sink is flushed, so a frame made of many pieces of text reaches the
+ *    terminal (or file) all at once. Sinks that draw on a screen can also
+ *    move the cursor, so part of the screen can be redrawn in place.
+ */
+class OutputSink {
+public:
+  /*
+   * Function: Destructor
+   * Description: Doesn't flush the sink, but should be marked as virtual for
+   *    derived classes.
+   */
+  virtual ~OutputSink() = default;
+
+  /*
+   * Function: write
+   * Description: Adds text at the cursor. The text is shown as it is, and
+   *    isn't read as a format string.
+   * Parameters:
+   *    text (string_view): The text to add.
+   */
+  virtual void write(std::string_view text) = 0;
+
+  /*
+   * Function: clear
+   * Description: Removes everything drawn so far, moving the cursor to the
+   *    top left of the screen. Sinks without a screen mark the clear in their
+   *    output instead.
+   */
+  virtual void clear() = 0;
+
+  /*
+   * Function: flush
+   * Description: Shows everything written since the last flush.
+   */
+  virtual void flush() = 0;
+
+  /*
+   * Function: hasCursor
+   * Returns (bool): True if the sink draws on a screen, so the cursor
+   *    functions below do something.
+   */
+  virtual bool hasCursor() const {
+    return false;
+  }
+
+  /*
+   * Function: getSize
+   * Description: Gets the number of lines and columns on the screen.
+   * Parameters:
+   *    rows (int&): Set to the number of lines.
+   *    cols (int&): Set to the number of columns.
+   * Returns (bool): False if the sink has no screen, or its size isn't known,
+   *    in which case rows and cols are left unchanged.
+   */
+  virtual bool getSize(int&, int&) {
+    return false;
+  }
+
+  /*
+   * Function(s): moveCursor, clearToLineEnd, clearToBottom
+   * Description: Move the cursor to a line and column, counted from 0, or
+   *    clear the screen from the cursor to the end of its line or to the
+   *    bottom of the screen. Do nothing for sinks without a cursor.
+   */
+  virtual void moveCursor(int, int) {}
+  virtual void clearToLineEnd() {}
+  virtual void clearToBottom() {}
+};
+
+#endif
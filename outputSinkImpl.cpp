@@ -0,0 +1,180 @@
+#include "outputSinkImpl.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "ioSpDef.hpp"
+
+#ifdef __linux__
+  #include <sys/ioctl.h>
+  #include <unistd.h>
+#endif
+
+
+
+void CursesSink::write(const std::string_view text) {
+  PRINT_TEXT(text.data(), (int)text.size());
+}
+
+void CursesSink::clear() {
+#ifndef CURSOR_CONTROL
+  // The console is cleared straight away, so text still waiting to be written
+  // has to go first
+  REFRESH_SCREEN;
+#endif
+  CLEAR_SCREEN;
+}
+
+void CursesSink::flush() {
+  REFRESH_SCREEN;
+}
+
+bool CursesSink::hasCursor() const {
+#ifdef CURSOR_CONTROL
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool CursesSink::getSize(int& rows, int& cols) {
+#ifdef CURSOR_CONTROL
+  updateScreenSize();
+  SCREEN_SIZE(rows, cols);
+  return rows > 0 && cols > 0;
+#else
+  return false;
+#endif
+}
+
+void CursesSink::moveCursor(const int row, const int col) {
+#ifdef CURSOR_CONTROL
+  MOVE_CURSOR(row, col);
+#endif
+}
+
+void CursesSink::clearToLineEnd() {
+#ifdef CURSOR_CONTROL
+  CLEAR_TO_LINE_END;
+#endif
+}
+
+void CursesSink::clearToBottom() {
+#ifdef CURSOR_CONTROL
+  CLEAR_TO_BOTTOM;
+#endif
+}
+
+
+
+void AnsiSink::write(const std::string_view text) {
+  buffer += text;
+}
+
+void AnsiSink::clear() {
+  buffer += "\x1b[H\x1b[2J";
+}
+
+void AnsiSink::flush() {
+#ifdef __linux__
+  // Skip stdio's buffer, and write the frame to the terminal in one call
+  // unless the terminal takes it in parts
+  std::size_t done = 0;
+  while(done < buffer.size()) {
+    ssize_t written = ::write(STDOUT_FILENO, buffer.data() + done,
+        buffer.size() - done);
+    if(written < 0 && errno != EINTR) {
+      break;
+    }
+    done += written > 0 ? (std::size_t)written : 0;
+  }
+#else
+  std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+  std::fflush(stdout);
+#endif
+  buffer.clear();
+}
+
+bool AnsiSink::hasCursor() const {
+  return true;
+}
+
+bool AnsiSink::getSize(int& rows, int& cols) {
+#ifdef __linux__
+  struct winsize size;
+  if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0 &&
+      size.ws_col > 0) {
+    rows = size.ws_row;
+    cols = size.ws_col;
+    return true;
+  }
+#endif
+  return false;
+}
+
+void AnsiSink::moveCursor(const int row, const int col) {
+  // ANSI counts lines and columns from 1
+  buffer += "\x1b[" + std::to_string(row + 1) + ';' +
+      std::to_string(col + 1) + 'H';
+}
+
+void AnsiSink::clearToLineEnd() {
+  buffer += "\x1b[K";
+}
+
+void AnsiSink::clearToBottom() {
+  buffer += "\x1b[J";
+}
+
+
+
+void StdoutSink::write(const std::string_view text) {
+  buffer += text;
+}
+
+void StdoutSink::clear() {
+  buffer += '\f';
+}
+
+void StdoutSink::flush() {
+  std::cout.write(buffer.data(), buffer.size());
+  std::cout.flush();
+  buffer.clear();
+}
+
+
+
+FileSink::FileSink(const std::string& path) : file(path,
+    std::ios::binary | std::ios::trunc) {
+  if(!file) {
+    throw std::runtime_error("Couldn't create the output file: " + path);
+  }
+}
+
+FileSink::~FileSink() {
+  flush();
+}
+
+void FileSink::write(const std::string_view text) {
+  buffer += text;
+}
+
+void FileSink::clear() {
+  buffer += '\f';
+}
+
+void FileSink::flush() {
+  file.write(buffer.data(), buffer.size());
+  file.flush();
+  buffer.clear();
+}
+
+
+
+void NullSink::write(std::string_view) {}
+
+void NullSink::clear() {}
+
+void NullSink::flush() {}
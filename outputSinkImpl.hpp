@@ -0,0 +1,100 @@
+#ifndef OUTPUT_SINK_IMPL_HPP
+#define OUTPUT_SINK_IMPL_HPP
+
+#include <fstream>
+#include <string>
+
+#include "outputSink.hpp"
+
+
+// Draws on the curses screen, or the console where curses isn't available.
+// Curses keeps its own copy of the screen, so text is written to it directly
+// and only sent to the terminal when the sink is flushed. Curses must be
+// started (CURSES_INIT) before the sink is used.
+class CursesSink : public OutputSink {
+public:
+  void write(std::string_view text) override;
+  void clear() override;
+  void flush() override;
+
+  bool hasCursor() const override;
+  bool getSize(int& rows, int& cols) override;
+  void moveCursor(int row, int col) override;
+  void clearToLineEnd() override;
+  void clearToBottom() override;
+};
+
+
+// Draws on a terminal that understands ANSI escape codes, by writing the codes
+// to standard output. Everything written between flushes is kept in a buffer
+// and written to the file descriptor with a single call. Unlike curses, it
+// keeps no copy of the screen, so the codes sent are only those the caller
+// asks for.
+class AnsiSink : public OutputSink {
+private:
+  std::string buffer;
+
+public:
+  void write(std::string_view text) override;
+  void clear() override;
+  void flush() override;
+
+  bool hasCursor() const override;
+  bool getSize(int& rows, int& cols) override;
+  void moveCursor(int row, int col) override;
+  void clearToLineEnd() override;
+  void clearToBottom() override;
+};
+
+
+// Writes plain text to standard output, such as when it isn't a terminal.
+// Clearing the screen writes a form feed.
+class StdoutSink : public OutputSink {
+private:
+  std::string buffer;
+
+public:
+  void write(std::string_view text) override;
+  void clear() override;
+  void flush() override;
+};
+
+
+// Writes plain text to a file, with a form feed wherever the screen was
+// cleared
+class FileSink : public OutputSink {
+private:
+  std::ofstream file;
+  std::string buffer;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Creates the file, replacing it if it already exists.
+   * Parameters:
+   *    path (string): The file to write.
+   * Effects: Throws std::runtime_error if the file can't be created.
+   */
+  FileSink(const std::string& path);
+
+  /*
+   * Function: Destructor
+   * Description: Writes any text that hasn't been flushed.
+   */
+  ~FileSink() override;
+
+  void write(std::string_view text) override;
+  void clear() override;
+  void flush() override;
+};
+
+
+// Discards everything written to it
+class NullSink : public OutputSink {
+public:
+  void write(std::string_view text) override;
+  void clear() override;
+  void flush() override;
+};
+
+#endif
@@ -38,7 +38,7 @@ void Player::addItem(Item* item) {
   items.push_back(item);
 }
 
-Item* Player::getItem(const std::string& name) {
+Item* Player::getItem(const std::string_view name) {
   for(Item* i : items) {
     if(i->name() == name) {
       return i;
@@ -47,7 +47,7 @@ Item* Player::getItem(const std::string& name) {
   return nullptr;
 }
 
-bool Player::removeItem(const std::string& name) {
+bool Player::removeItem(const std::string_view name) {
   for(std::vector<Item*>::iterator it = items.begin();
       it != items.end(); ++it) {
     if((*it)->name() == name) {
@@ -73,6 +73,10 @@ GameUpdate::pointer Player::turnUpdate(Player* const active, const bool round) {
   return nullptr;
 }
 
+bool Player::receivesTurnUpdates() const {
+  return false;
+}
+
 GameUpdate::pointer Player::triggerUpdate(Trigger* const trigger) {
   return nullptr;
 }
@@ -91,7 +91,7 @@ public:
    * Returns (Item*): A pointer to the item with the given name, or returns
    *    nullptr if it isn't found in the player's item list.
    */
-  Item* getItem(const std::string& name);
+  Item* getItem(std::string_view name);
   
   /*
    * Function: removeItem
@@ -102,7 +102,7 @@ public:
    * Returns (bool): True if an item with the given name is found.
    * Effects: Removes any items with the given name from the list of items.
    */
-  bool removeItem(const std::string& name);
+  bool removeItem(std::string_view name);
 
   /*
    * Function: character
@@ -137,6 +137,15 @@ public:
    */
   virtual GameUpdate::pointer turnUpdate(Player* active, bool round);
 
+  /*
+   * Function: receivesTurnUpdates
+   * Description: Whether the cave should call turnUpdate for this player. A
+   *    player overriding turnUpdate should override this to return true. It is
+   *    checked each time the player is added to a room.
+   * Returns (bool): False by default.
+   */
+  virtual bool receivesTurnUpdates() const;
+
   /*
    * Function: triggerUpdate
    * Description: Will be called when a trigger moves to the same room as the
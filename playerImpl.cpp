@@ -22,6 +22,10 @@ int BasicPlayer::toDirection(int input) const {
   if(input == 'd') {
     return RightDir;
   }
+  if(input >= '1' && input <= '9') {
+    // Numbered tunnels, for caves that aren't grids
+    return input - '1';
+  }
   return NONE;
 }
 
@@ -66,6 +70,12 @@ GameUpdate::pointer BasicPlayer::getTurnAction(const int input) {
   else if(input == ' ') {
     update = getFireAction();
   }
+  else if(input == GAME_EXIT_CODE) {
+    // Ask to quit the game (player entered 'x'), and carry on if they don't
+    update = new GameUpdate(GameUpdate::ForceGameEnd);
+    update.append(new GameUpdate(GameUpdate::GetPlayerInput,
+        this, turnActionID));
+  }
 
   if(!update) {
     update = new GameUpdate(GameUpdate::DisplayText,
@@ -95,6 +105,10 @@ GameUpdate::pointer BasicPlayer::getDirectionAction(const int input,
     }
     reprompt = false;
   }
+  else if(input == GAME_EXIT_CODE) {
+    update = new GameUpdate(GameUpdate::ForceGameEnd);
+    reprompt = true;
+  }
   else {
     update = new GameUpdate(GameUpdate::DisplayText,
         "Invalid action. Please try again.");
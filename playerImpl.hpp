@@ -5,7 +5,8 @@ protected:
   /*
    * Function: toDirection
    * Description: Returns a direction if the given character is a valid
-   *    direction character (w/a/s/d) and NONE otherwise
+   *    direction character (w/a/s/d, or 1-9 for numbered tunnels) and NONE
+   *    otherwise
    * Parameters:
    *     input (int): The character to check
    * Returns (int): Direction corresponding to the character or NONE.
@@ -0,0 +1,60 @@
+#include "random.hpp"
+
+
+// Rotates the bits of x left by k places
+static inline std::uint64_t rotl(const std::uint64_t x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+
+Random::Random(const std::uint64_t seedValue) : stream(nullptr) {
+  seed(seedValue);
+}
+
+void Random::seed(std::uint64_t seedValue) {
+  // Expand the seed with splitmix64, which never produces an all zero state
+  for(std::uint64_t& s : state) {
+    seedValue += 0x9e3779b97f4a7c15;
+    std::uint64_t z = seedValue;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    s = z ^ (z >> 31);
+  }
+}
+
+void Random::setStream(RandomStream* const randomStream) {
+  stream = randomStream;
+}
+
+std::uint64_t Random::next() {
+  const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+  const std::uint64_t t = state[1] << 17;
+
+  state[2] ^= state[0];
+  state[3] ^= state[1];
+  state[1] ^= state[2];
+  state[0] ^= state[3];
+  state[2] ^= t;
+  state[3] = rotl(state[3], 45);
+
+  if(stream) {
+    return stream->draw(result);
+  }
+  return result;
+}
+
+int Random::index(const int size) {
+  // Scale the top 32 bits into the range without a division. The bias this
+  // leaves is far too small to matter for board sizes.
+  const std::uint64_t bits = next() >> 32;
+  return (int)((bits * (std::uint64_t)size) >> 32);
+}
+
+double Random::real() {
+  // The top 53 bits fill the mantissa of a double exactly
+  return (double)(next() >> 11) * 0x1.0p-53;
+}
+
+bool Random::chance(const double probability) {
+  return real() < probability;
+}
@@ -0,0 +1,95 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+
+// Observes or replaces the numbers drawn from a Random object, so games can
+// be recorded and replayed
+class RandomStream {
+public:
+  virtual ~RandomStream() = default;
+
+  /*
+   * Function: draw
+   * Description: Called with every number the generator produces.
+   * Parameters:
+   *    generated (uint64_t): The number the generator produced.
+   * Returns (uint64_t): The number to use in its place.
+   */
+  virtual std::uint64_t draw(std::uint64_t generated) = 0;
+};
+
+
+// A small, fast random number generator (xoshiro256**). Each game owns its
+// own generator so games are reproducible from their seed and can be run on
+// separate threads.
+class Random {
+private:
+  std::uint64_t state[4];
+  // Not owned. Copies of the generator share the stream.
+  RandomStream* stream;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Seeds the generator. The same seed always produces the same
+   *    sequence of numbers.
+   * Parameters:
+   *    seed (uint64_t): The number to seed the generator with.
+   */
+  Random(std::uint64_t seed = 0);
+
+  /*
+   * Function: seed
+   * Description: Restarts the generator from the given seed.
+   * Parameters:
+   *    seed (uint64_t): The number to seed the generator with.
+   */
+  void seed(std::uint64_t seed);
+
+  /*
+   * Function: setStream
+   * Description: Passes every number drawn from now on through the given
+   *    stream, or stops doing so if it is nullptr.
+   * Parameters:
+   *    stream (RandomStream*): The stream to use. Must outlive the generator
+   *      and any copies of it.
+   */
+  void setStream(RandomStream* stream);
+
+  /*
+   * Function: next
+   * Description: Advances the generator.
+   * Returns (uint64_t): The next 64 random bits.
+   */
+  std::uint64_t next();
+
+  /*
+   * Function: index
+   * Description: Generates a random index of a vector with the given size.
+   * Parameters:
+   *    size (int): The maximum value of the random number, exclusive. Must be
+   *      greater than zero.
+   * Returns (int): A random number between 0 and size, not including size
+   *    itself.
+   */
+  int index(int size);
+
+  /*
+   * Function: real
+   * Returns (double): A random number between 0 and 1, not including 1.
+   */
+  double real();
+
+  /*
+   * Function: chance
+   * Description: Returns true with the given probability.
+   * Parameters:
+   *    probability (double): The chance of returning true, from 0 to 1.
+   * Returns (bool): True with the given probability, false otherwise.
+   */
+  bool chance(double probability);
+};
+
+#endif
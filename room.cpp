@@ -1,18 +1,14 @@
 #include "room.hpp"
 
-#include <random>
 
+Room::Room() : defaultEvent(nullptr), perceptMode(NONE), perceptCount(0) {}
 
-int Room::randIndex(const int size) {
-  return rand() % size;
-}
-
-
-Room::Room() = default;
+Room::Room(const RoomPos& pos) : pos(pos), defaultEvent(nullptr), events(),
+    perceptMode(NONE), perceptCount(0) {}
 
-Room::Room(const RoomPos& pos) : pos(pos), events() {}
-
-Room::Room(const Room& other) : pos(other.pos), events(other.events.size()) {
+Room::Room(const Room& other) : pos(other.pos),
+    defaultEvent(other.defaultEvent), events(other.events.size()),
+    perceptMode(NONE), perceptCount(0) {
   auto it = events.begin();
   auto oit = other.events.begin();
   for(; it != events.end(); ++it, ++oit) {
@@ -29,7 +25,9 @@ Room& Room::operator=(const Room& other) {
 
     // Assign members
     pos = other.pos;
+    defaultEvent = other.defaultEvent;
     events.resize(other.events.size());
+    perceptMode = NONE;
     
     // Deep copy pointers
     auto it = events.begin();
@@ -54,12 +52,27 @@ void Room::setLocation(const RoomPos& loc) {
   pos = loc;
 }
 
+void Room::setDefaultEvent(Event* const ev) {
+  defaultEvent = ev;
+  perceptMode = NONE;
+}
+
 bool Room::empty() const {
   // The room is empty if it contains only the default event
-  return (events.size() <= 1 && players.size() == 0);
+  return (events.empty() && players.empty());
+}
+
+const std::vector<Event*>& Room::getEvents() const {
+  return events;
+}
+const std::vector<Player*>& Room::getPlayers() const {
+  return players;
 }
 
 Event* Room::getEvent(const std::string& eventName) {
+  if(defaultEvent && defaultEvent->name() == eventName) {
+    return defaultEvent;
+  }
   for(Event* ev : events) {
     if(ev->name() == eventName) {
       return ev;
@@ -70,11 +83,13 @@ Event* Room::getEvent(const std::string& eventName) {
 
 void Room::addEvent(Event* const event) {
   events.push_back(event);
+  perceptMode = NONE;
 }
 void Room::removeEvent(Event* const event) {
   for(auto it = events.begin(); it != events.end(); ++it) {
     if(*it == event) {
       events.erase(it);
+      perceptMode = NONE;
       return;
     }
   }
@@ -99,6 +114,12 @@ char Room::getChar(const int mode) const {
       return c;
     }
   }
+  if(defaultEvent) {
+    char c = defaultEvent->character(mode);
+    if(c != (char)NONE) {
+      return c;
+    }
+  }
   for(const Event* ev : events) {
     char c = ev->character(mode);
     if(c != (char)NONE) {
@@ -108,30 +129,77 @@ char Room::getChar(const int mode) const {
   return (char)NONE;
 }
 
-std::string Room::getPercepts(const int mode) const {
-  std::vector<Event*> randomOrderEvents = events;
-  for(int i = 0; i < randomOrderEvents.size(); ++i) {
-    int index = randIndex(randomOrderEvents.size());
-    std::swap(randomOrderEvents.at(i), randomOrderEvents.at(index));
+void Room::cachePercepts(const int mode) const {
+  percepts.clear();
+  if(defaultEvent) {
+    percepts.push_back(defaultEvent->getPercept(mode));
+  }
+  for(const Event* ev : events) {
+    percepts.push_back(ev->getPercept(mode));
   }
 
-  std::string percepts;
-  for(const Event* ev : randomOrderEvents) {
-    percepts += ev->getPercept(mode);
+  perceptCount = 0;
+  for(const std::string& percept : percepts) {
+    if(!percept.empty()) {
+      perceptCount++;
+    }
   }
-  return percepts;
+  perceptMode = mode;
+}
+
+std::string Room::getPercepts(const int mode, Random& random) const {
+  if(perceptMode != mode) {
+    cachePercepts(mode);
+  }
+
+  // Shuffle the events' percepts, drawing one number for every event even
+  // when the order can't change the text, so the game draws the same numbers
+  const int count = (int)percepts.size();
+  if(perceptCount <= 1) {
+    for(int i = 0; i < count; ++i) {
+      random.index(count);
+    }
+    for(const std::string& percept : percepts) {
+      if(!percept.empty()) {
+        return percept;
+      }
+    }
+    return std::string();
+  }
+
+  std::vector<int> order(count);
+  for(int i = 0; i < count; ++i) {
+    order[i] = i;
+  }
+  for(int i = 0; i < count; ++i) {
+    int index = random.index(count);
+    std::swap(order[i], order[index]);
+  }
+
+  std::string text;
+  for(int i : order) {
+    text += percepts[i];
+  }
+  return text;
 }
 
 GameUpdate::pointer Room::triggerTurnUpdate(Player* const active,
     const bool round) {
   GameUpdate::pointer update = nullptr;
   for(Player* pl : players) {
-    GameUpdate::pointer p = pl->turnUpdate(active, round);
-    update.append(p);
+    if(pl->receivesTurnUpdates()) {
+      GameUpdate::pointer p = pl->turnUpdate(active, round);
+      update.append(p);
+    }
+  }
+  if(defaultEvent && defaultEvent->receivesTurnUpdates()) {
+    update.append(defaultEvent->turnUpdate(active, round));
   }
   for(Event* ev : events) {
-    GameUpdate::pointer p = ev->turnUpdate(active, round); // Get the gameUpdate
-    update.append(p); // Add it to the end of update
+    if(ev->receivesTurnUpdates()) {
+      GameUpdate::pointer p = ev->turnUpdate(active, round); // Get the gameUpdate
+      update.append(p); // Add it to the end of update
+    }
   }
   return update;
 }
@@ -142,6 +210,9 @@ GameUpdate::pointer Room::triggerEvents(Trigger* const trigger) {
     GameUpdate::pointer p = pl->triggerUpdate(trigger);
     update.append(p);
   }
+  if(defaultEvent) {
+    update.append(defaultEvent->triggerUpdate(trigger));
+  }
   for(Event* ev : events) {
     GameUpdate::pointer p = ev->triggerUpdate(trigger); // Get the gameUpdate
     update.append(p); // Add it to the end of update
@@ -3,24 +3,34 @@
 
 #include "event.hpp"
 #include "player.hpp"
+#include "random.hpp"
 
 // Room interface
 class Room {
 private: 
   RoomPos pos;
+  // The cave's default event, shared by every room and not owned by this one.
+  // It acts as the first event in the room without being in the list.
+  Event* defaultEvent;
   std::vector<Event*> events;
   std::vector<Player*> players;
 
+  // The percept of the default event and of each event, in that order, for
+  // the display mode perceptMode (NONE when nothing is cached). Percepts only
+  // change when an event is added or removed, so that clears the cache.
+  mutable std::vector<std::string> percepts;
+  mutable int perceptMode;
+  // The number of cached percepts that aren't empty
+  mutable int perceptCount;
+
   /*
-   * Function: randIndex
-   * Description: Generates a random number index of a vector with the given
-   *    size.
+   * Function: cachePercepts
+   * Description: Fills the percept cache with the percepts of the room's
+   *    events for the given display mode.
    * Parameters:
-   *    size (int): The maximum value of the random number, exclusive.
-   * Returns (int): A random number between 0 and size, not including size
-   *    itself.
+   *    mode (int): The game display mode.
    */
-  static int randIndex(int size);
+  void cachePercepts(int mode) const;
 
 public:
   /*
@@ -36,14 +46,16 @@ public:
 
   /*
    * Function: Copy Constructor
-   * Description: Copies all values and clones all events from the other room.
+   * Description: Copies all values and clones all events from the other room,
+   *    except the shared default event.
    * Parameters:
    *    other (Room): The Room object to copy values from.
    */
   Room(const Room& other);
   /*
    * Function: Copy Assignment
-   * Description: Copies all values and clones all events from the other room.
+   * Description: Copies all values and clones all events from the other room,
+   *    except the shared default event.
    * Parameters:
    *    other (Room): The Room object to copy values from.
    */
@@ -51,7 +63,8 @@ public:
 
   /*
    * Function: Destructor
-   * Description: Deletes all events assigned to the room.
+   * Description: Deletes all events assigned to the room, other than the
+   *    shared default event.
    */
   ~Room();
 
@@ -69,14 +82,34 @@ public:
    */
   void setLocation(const RoomPos& loc);
 
+  /*
+   * Function: setDefaultEvent
+   * Description: Simple setter for the default event shared by every room.
+   *    The room doesn't take ownership of it.
+   * Parameters:
+   *    ev (Event*): The shared default event, or nullptr for none.
+   */
+  void setDefaultEvent(Event* ev);
+
   /*
    * Function: empty
-   * Description: Returns true if the room has no events other than the default
-   *    event.
-   * Returns (bool): True if the room only has one event, and false otherwise.
+   * Description: Returns true if the room has no players or events other than
+   *    the default event.
+   * Returns (bool): True if the room has no players and no events of its own,
+   *    and false otherwise.
    */
   bool empty() const;
 
+  /*
+   * Function(s): getEvents, getPlayers
+   * Description: Simple getters for the events and players in the room, in
+   *    the order they were added. The default event isn't included.
+   * Returns (vector<Event*> or vector<Player*>): The room's own events or
+   *    players.
+   */
+  const std::vector<Event*>& getEvents() const;
+  const std::vector<Player*>& getPlayers() const;
+
   /*
    * Function: getEvent
    * Description: Returns a pointer to the first event with the given name in
@@ -136,18 +169,20 @@ public:
   /*
    * Function: getPercepts
    * Description: Returns a string containing each percept from events in the
-   *    room in a random order.
+   *    room in a random order. The percepts are cached until an event is added
+   *    to or removed from the room.
    * Parameters:
    *    mode (int): The game display mode.
+   *    random (Random&): The generator used to order the percepts.
    * Returns (string): The string to display, containing each percept from the
    *    room. Randomly orders percepts if there are multiple.
    */
-  std::string getPercepts(int mode) const;
+  std::string getPercepts(int mode, Random& random) const;
 
   /*
    * Function: triggerTurnUpdate
    * Description: Calls the turnUpdate function for each player and event in
-   *    the room.
+   *    the room that receives turn updates.
    * Parameters:
    *    active (Player*): The player whose turn it is.
    *    round (bool): True if it is the first turn of a round.
@@ -0,0 +1,111 @@
+#include "threadPool.hpp"
+
+
+
+bool ThreadPool::takeTask(const std::size_t worker, Task& task) {
+  {
+    WorkQueue& own = *queues[worker];
+    std::lock_guard<std::mutex> guard(own.lock);
+    if(!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued--;
+      return true;
+    }
+  }
+
+  for(std::size_t i = 1; i < queues.size(); ++i) {
+    WorkQueue& other = *queues[(worker + i) % queues.size()];
+    std::lock_guard<std::mutex> guard(other.lock);
+    if(!other.tasks.empty()) {
+      task = std::move(other.tasks.front());
+      other.tasks.pop_front();
+      queued--;
+      steals++;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::workerLoop(const std::size_t worker) {
+  Task task;
+  while(true) {
+    if(takeTask(worker, task)) {
+      task();
+      task = nullptr;
+      if(--pending == 0) {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        allDone.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepLock);
+    workAvailable.wait(lock, [this] { return stopping || queued > 0; });
+    if(stopping && queued == 0) {
+      return;
+    }
+  }
+}
+
+
+
+ThreadPool::ThreadPool(unsigned threads) : queued(0), pending(0),
+    nextQueue(0), steals(0), stopping(false) {
+  if(threads == 0) {
+    threads = std::thread::hardware_concurrency();
+    if(threads == 0) {
+      threads = 1;
+    }
+  }
+
+  for(unsigned i = 0; i < threads; ++i) {
+    queues.push_back(std::make_unique<WorkQueue>());
+  }
+  for(unsigned i = 0; i < threads; ++i) {
+    workers.emplace_back(&ThreadPool::workerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  wait();
+  {
+    std::lock_guard<std::mutex> guard(sleepLock);
+    stopping = true;
+  }
+  workAvailable.notify_all();
+  for(std::thread& t : workers) {
+    t.join();
+  }
+}
+
+void ThreadPool::submit(Task task) {
+  pending++;
+  WorkQueue& queue = *queues[nextQueue++ % queues.size()];
+  {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    queue.tasks.push_back(std::move(task));
+    queued++;
+  }
+
+  // Taking the lock keeps a worker from missing the wake up between checking
+  // for work and going to sleep
+  {
+    std::lock_guard<std::mutex> guard(sleepLock);
+  }
+  workAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+  std::unique_lock<std::mutex> lock(sleepLock);
+  allDone.wait(lock, [this] { return pending == 0; });
+}
+
+std::size_t ThreadPool::size() const {
+  return workers.size();
+}
+
+std::size_t ThreadPool::stealCount() const {
+  return steals;
+}
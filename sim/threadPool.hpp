@@ -0,0 +1,112 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// A fixed set of worker threads that run submitted tasks. Each worker has its
+// own queue, and a worker that runs out of tasks steals from the others, so
+// games of very different lengths still keep every core busy.
+class ThreadPool {
+public:
+  typedef std::function<void()> Task;
+
+private:
+  struct WorkQueue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  std::vector<std::thread> workers;
+
+  // Tasks sitting in a queue, and tasks submitted but not yet finished
+  std::atomic<std::size_t> queued;
+  std::atomic<std::size_t> pending;
+  std::atomic<std::size_t> nextQueue;
+  std::atomic<std::size_t> steals;
+  bool stopping;
+
+  std::mutex sleepLock;
+  std::condition_variable workAvailable;
+  std::condition_variable allDone;
+
+  /*
+   * Function: takeTask
+   * Description: Takes the newest task from the worker's own queue, or if it
+   *    is empty, steals the oldest task from another worker's queue.
+   * Parameters:
+   *    worker (size_t): The index of the worker looking for a task.
+   *    task (Task&): Set to the task taken, if any.
+   * Returns (bool): True if a task was taken.
+   */
+  bool takeTask(std::size_t worker, Task& task);
+
+  /*
+   * Function: workerLoop
+   * Description: Runs tasks until the pool is destroyed, sleeping while there
+   *    are none to run.
+   * Parameters:
+   *    worker (size_t): The index of this worker's queue.
+   */
+  void workerLoop(std::size_t worker);
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Starts the given number of worker threads.
+   * Parameters:
+   *    threads (unsigned): The number of workers. Zero uses one worker per
+   *      hardware thread.
+   */
+  ThreadPool(unsigned threads = 0);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  /*
+   * Function: Destructor
+   * Description: Waits for every submitted task to finish, then stops the
+   *    worker threads.
+   */
+  ~ThreadPool();
+
+  /*
+   * Function: submit
+   * Description: Queues a task to be run by one of the workers. Tasks are
+   *    spread across the workers' queues in turn.
+   * Parameters:
+   *    task (Task): The task to run. It must not throw.
+   */
+  void submit(Task task);
+
+  /*
+   * Function: wait
+   * Description: Blocks until every task submitted so far has finished.
+   */
+  void wait();
+
+  /*
+   * Function: size
+   * Returns (size_t): The number of worker threads.
+   */
+  std::size_t size() const;
+
+  /*
+   * Function: stealCount
+   * Returns (size_t): The number of tasks run by a worker other than the one
+   *    they were queued for.
+   */
+  std::size_t stealCount() const;
+};
+
+#endif
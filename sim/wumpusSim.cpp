@@ -0,0 +1,255 @@
+/*
+ * Description: Plays many complete games of Hunt the Wumpus without a
+ *    terminal, spread across a pool of worker threads, and reports how often
+ *    a player pressing random keys wins, loses, or gives up. Every game has
+ *    its own LoadMods, GameSetup, and Cave objects and its own random number
+ *    generator, so the games share no state and the results of a run can be
+ *    reproduced from its seed. Given a saved cave, every game starts in it
+ *    instead of placing its own events.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "caveSnapshot.hpp"
+#include "game.hpp"
+#include "gameIOImpl.hpp"
+#include "loadMods.hpp"
+#include "random.hpp"
+#include "threadPool.hpp"
+
+
+struct SimOptions {
+  int games = 10000;
+  unsigned threads = 0;
+  int width = 6;
+  int height = 6;
+  // A value of CaveTopologies
+  int topology = GridTopology;
+  std::uint32_t seed = std::random_device()();
+  // Keys a player presses before trying to quit the game
+  int maxKeys = 500;
+  // Empty to play the base game without mods
+  std::string modDir;
+  // A saved cave to play every game in, or empty to set up each game's cave
+  std::string cavePath;
+};
+
+struct GameResult {
+  enum Outcome { Won, Lost, Quit, Error };
+
+  Outcome outcome = Error;
+  int turns = 0;
+  std::size_t keys = 0;
+};
+
+
+/*
+ * Function: playGame
+ * Description: Plays one game, pressing random movement and fire keys until
+ *    the game ends or the key limit is reached, then quits.
+ * Parameters:
+ *    options (SimOptions): The board size, key limit, and mods to use.
+ *    cave (CaveSnapshot*): The cave to play in, or nullptr to set one up.
+ *    seed (uint32_t): The seed for the game and for the keys pressed.
+ * Returns (GameResult): How the game ended and how long it took.
+ */
+static GameResult playGame(const SimOptions& options,
+    const CaveSnapshot* const cave, const std::uint32_t seed) {
+  static constexpr char actionKeys[] = { 'w', 'a', 's', 'd', ' ' };
+  // Give up if a game still hasn't ended long after asking to quit
+  const int quitKeys = options.maxKeys + 1000;
+
+  GameResult result;
+  try {
+    LoadMods mods;
+    mods.setSetupVars({
+      { GameSetup::GameMode, 0 },
+      { GameSetup::Height, options.height },
+      { GameSetup::Width, options.width },
+      { GameSetup::Seed, (int)seed },
+      { GameSetup::Topology, options.topology },
+    });
+    mods.setSnapshot(cave);
+    if(!options.modDir.empty()) {
+      mods.loadModHandles(options.modDir);
+    }
+    mods.loadObjs();
+
+    // Keep the keys separate from the game's generator so mods that draw
+    // more or fewer numbers don't change which keys are pressed
+    Random keys(~(std::uint64_t)seed);
+    int pressed = 0;
+    ScriptedIO io([&]() -> int {
+      pressed++;
+      if(pressed > quitKeys) {
+        throw std::runtime_error("The game didn't end after quitting.");
+      }
+      if(pressed > options.maxKeys) {
+        // Answer the exit confirmation
+        return (pressed - options.maxKeys) % 2 ? 'x' : 'y';
+      }
+      return actionKeys[keys.index(sizeof(actionKeys))];
+    });
+
+    Game game(mods.getSetup(), mods.getCave(), &io);
+    game.playGame();
+
+    if(game.checkWin()) {
+      result.outcome = GameResult::Won;
+    } else if(game.checkLose()) {
+      result.outcome = GameResult::Lost;
+    } else {
+      result.outcome = GameResult::Quit;
+    }
+    result.turns = game.getTurnCount();
+    result.keys = io.keysPressed();
+
+  } catch(const std::exception& e) {
+    std::fprintf(stderr, "Game with seed %u failed: %s\n", seed, e.what());
+    result.outcome = GameResult::Error;
+  }
+  return result;
+}
+
+/*
+ * Function: parseOptions
+ * Description: Reads the command line options into a SimOptions object.
+ * Returns (bool): False if an option wasn't recognized.
+ */
+static bool parseOptions(int argc, char** argv, SimOptions& options) {
+  for(int i = 1; i < argc; ++i) {
+    std::string option = argv[i];
+    if(i + 1 == argc) {
+      return false;
+    }
+    std::string value = argv[++i];
+
+    if(option == "--games") {
+      options.games = std::stoi(value);
+    } else if(option == "--threads") {
+      options.threads = (unsigned)std::stoul(value);
+    } else if(option == "--width") {
+      options.width = std::stoi(value);
+    } else if(option == "--height") {
+      options.height = std::stoi(value);
+    } else if(option == "--seed") {
+      options.seed = (std::uint32_t)std::stoul(value);
+    } else if(option == "--max-keys") {
+      options.maxKeys = std::stoi(value);
+    } else if(option == "--topology") {
+      if(value == "grid") {
+        options.topology = GridTopology;
+      } else if(value == "dodecahedron") {
+        options.topology = DodecahedronTopology;
+      } else {
+        return false;
+      }
+    } else if(option == "--mods") {
+      options.modDir = value;
+    } else if(option == "--cave") {
+      options.cavePath = value;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+int main(int argc, char** argv) {
+  SimOptions options;
+  if(!parseOptions(argc, argv, options)) {
+    std::fprintf(stderr, "Usage: %s [--games N] [--threads N] [--width N] "
+        "[--height N] [--seed N] [--max-keys N] "
+        "[--topology grid|dodecahedron] [--mods DIR] [--cave FILE]\n",
+        argv[0]);
+    return 1;
+  }
+
+  // Every game reads the same saved cave, which isn't changed while playing
+  CaveSnapshot snapshot;
+  const CaveSnapshot* cave = nullptr;
+  if(!options.cavePath.empty()) {
+    try {
+      snapshot.load(options.cavePath);
+    } catch(const std::exception& e) {
+      std::fprintf(stderr, "%s\n", e.what());
+      return 1;
+    }
+    cave = &snapshot;
+  }
+
+  std::vector<GameResult> results(options.games);
+  auto start = std::chrono::steady_clock::now();
+  std::size_t threads;
+  std::size_t steals;
+  {
+    ThreadPool pool(options.threads);
+    threads = pool.size();
+    // Each game writes only its own result, so no locking is needed
+    for(int i = 0; i < options.games; ++i) {
+      pool.submit([&options, &results, cave, i] {
+        results[i] = playGame(options, cave, options.seed + (std::uint32_t)i);
+      });
+    }
+    pool.wait();
+    steals = pool.stealCount();
+  }
+  double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  std::map<GameResult::Outcome, int> outcomes;
+  long totalTurns = 0;
+  long totalKeys = 0;
+  int minTurns = 0;
+  int maxTurns = 0;
+  int finished = 0;
+  for(const GameResult& r : results) {
+    outcomes[r.outcome]++;
+    if(r.outcome == GameResult::Error) {
+      continue;
+    }
+    minTurns = finished ? std::min(minTurns, r.turns) : r.turns;
+    maxTurns = std::max(maxTurns, r.turns);
+    totalTurns += r.turns;
+    totalKeys += r.keys;
+    finished++;
+  }
+
+  std::printf("games: %d\n", options.games);
+  if(cave && cave->getTopology() == DodecahedronTopology) {
+    std::printf("board: %s (dodecahedron)\n", options.cavePath.c_str());
+  } else if(cave) {
+    std::printf("board: %s (%dx%d)\n", options.cavePath.c_str(),
+        cave->getWidth(), cave->getHeight());
+  } else if(options.topology == DodecahedronTopology) {
+    std::printf("board: dodecahedron\n");
+  } else {
+    std::printf("board: %dx%d\n", options.width, options.height);
+  }
+  std::printf("seed: %u\n", options.seed);
+  std::printf("threads: %zu\n", threads);
+  std::printf("won: %d\n", outcomes[GameResult::Won]);
+  std::printf("lost: %d\n", outcomes[GameResult::Lost]);
+  std::printf("quit: %d\n", outcomes[GameResult::Quit]);
+  std::printf("errors: %d\n", outcomes[GameResult::Error]);
+  if(finished > 0) {
+    std::printf("win rate: %.4f\n", (double)outcomes[GameResult::Won] /
+        finished);
+    std::printf("turns min/mean/max: %d / %.2f / %d\n", minTurns,
+        (double)totalTurns / finished, maxTurns);
+    std::printf("keys per game: %.2f\n", (double)totalKeys / finished);
+  }
+  std::printf("seconds: %.3f\n", seconds);
+  std::printf("games per second: %.1f\n", options.games / seconds);
+  std::printf("tasks stolen: %zu\n", steals);
+  return outcomes[GameResult::Error] == 0 ? 0 : 2;
+}
@@ -0,0 +1,60 @@
+#include "sparseCave.hpp"
+
+
+Room& SparseCave::getRoom(const RoomIndex index) {
+  auto found = occupied.find(index);
+  if(found == occupied.end()) {
+    return emptyRoom;
+  }
+  return found->second;
+}
+const Room& SparseCave::getRoom(const RoomIndex index) const {
+  auto found = occupied.find(index);
+  if(found == occupied.end()) {
+    return emptyRoom;
+  }
+  return found->second;
+}
+
+Room& SparseCave::occupyRoom(const RoomIndex index) {
+  auto added = occupied.try_emplace(index, toPos(index));
+  if(added.second) {
+    added.first->second.setDefaultEvent(defaultEvent);
+  }
+  return added.first->second;
+}
+
+void SparseCave::updateEmptyRoom(const RoomIndex index) {
+  auto found = occupied.find(index);
+  if(found != occupied.end() && found->second.empty()) {
+    occupied.erase(found);
+  }
+}
+
+RoomPos SparseCave::chooseEmptyRoom() {
+  const int roomCount = height * width;
+  const int emptyCount = roomCount - (int)occupied.size();
+  if(emptyCount <= 0) {
+    return RoomPos(0,0);
+  }
+
+  if(emptyCount > roomCount / 2) {
+    while(true) {
+      RoomIndex index = random.index(roomCount);
+      if(!occupiedRooms.test(index)) {
+        return toPos(index);
+      }
+    }
+  }
+
+  RoomIndex chosen = occupiedRooms.find(random.index(emptyCount), false);
+  return notNone(chosen) ? toPos(chosen) : RoomPos(0,0);
+}
+
+
+
+SparseCave::SparseCave(const GameSetup* const setup) :
+    BasicCave(setup, false) {
+  emptyRoom.setDefaultEvent(defaultEvent);
+  addSetupEvents(setup);
+}
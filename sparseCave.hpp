@@ -0,0 +1,78 @@
+#ifndef SPARSE_CAVE_HPP
+#define SPARSE_CAVE_HPP
+
+#include <unordered_map>
+
+#include "caveImpl.hpp"
+
+
+// A BasicCave for very large boards that only stores the rooms holding
+// players or events other than the default event. Every other room is
+// represented by one shared empty room.
+class SparseCave : public BasicCave {
+public:
+  // Caves with more rooms than this are created sparse by LoadMods
+  static constexpr int minRooms = 1 << 16;
+
+protected:
+  // The occupied rooms, by RoomIndex
+  std::unordered_map<RoomIndex, Room> occupied;
+  // Stands in for every room that isn't occupied
+  Room emptyRoom;
+
+  using BasicCave::getRoom;
+
+  /*
+   * Function: getRoom(RoomIndex)
+   * Description: Returns the occupied room with the given index, or the
+   *    shared empty room if nothing is in it. Never creates a room.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   * Returns (Room&): A reference to the room with the given index.
+   */
+  Room& getRoom(RoomIndex index) override;
+  const Room& getRoom(RoomIndex index) const override;
+
+  /*
+   * Function: occupyRoom
+   * Description: Returns the room with the given index, creating it if it
+   *    isn't occupied yet.
+   * Parameters:
+   *    index (RoomIndex): The index of the room, from toIndex().
+   * Returns (Room&): A reference to the room with the given index.
+   */
+  Room& occupyRoom(RoomIndex index) override;
+
+  /*
+   * Function: updateEmptyRoom
+   * Description: Frees the room if it is empty again.
+   * Parameters:
+   *    index (RoomIndex): The index of the room that changed.
+   */
+  void updateEmptyRoom(RoomIndex index) override;
+
+  /*
+   * Function: chooseEmptyRoom
+   * Description: Randomly chooses an empty room in the cave and returns its
+   *    position. Picks random rooms until one is empty, which takes about one
+   *    try when most of the cave is empty. Once half of it is occupied, picks
+   *    one of the empty rooms by counting the clear bits of the occupied
+   *    board a word at a time.
+   * Returns (RoomPos): The position of the randomly chosen room.
+   */
+  RoomPos chooseEmptyRoom() override;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Creates the cave based on setup variables from the user and
+   *    events that should be placed in the cave, storing only the rooms the
+   *    events and players are in.
+   * Parameters:
+   *    setup (GameSetup*): Contains setup variables and events to use to
+   *      create the game board.
+   */
+  SparseCave(const GameSetup* setup);
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "updateArena.hpp"
+
+#include <new>
+
+#include "gameUpdatePointer.hpp"
+
+
+UpdateArena::UpdateArena(const std::size_t size) : blockSize(size),
+    currentChunk(0), chunkOffset(0), freeList(nullptr), live(0),
+    systemAllocations(0) {
+  // Every block must be able to hold a free list link, and stay aligned
+  constexpr std::size_t align = alignof(std::max_align_t);
+  if(blockSize < sizeof(FreeBlock)) {
+    blockSize = sizeof(FreeBlock);
+  }
+  blockSize = (blockSize + align - 1) / align * align;
+}
+
+UpdateArena::~UpdateArena() {
+  if(live > 0) {
+    return;
+  }
+  for(char* chunk : chunks) {
+    ::operator delete(chunk);
+  }
+}
+
+UpdateArena& UpdateArena::local() {
+  constexpr std::size_t size = sizeof(GameUpdate) >
+      sizeof(GameUpdate::pointer) ? sizeof(GameUpdate) :
+      sizeof(GameUpdate::pointer);
+  thread_local UpdateArena arena(size);
+  return arena;
+}
+
+
+void* UpdateArena::allocate(const std::size_t size) {
+  if(size > blockSize) {
+    return ::operator new(size);
+  }
+  live++;
+
+  if(freeList) {
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    return block;
+  }
+
+  if(currentChunk < chunks.size() && chunkOffset == blocksPerChunk) {
+    currentChunk++;
+    chunkOffset = 0;
+  }
+  if(currentChunk == chunks.size()) {
+    chunks.push_back(static_cast<char*>(
+        ::operator new(blockSize * blocksPerChunk)));
+    systemAllocations++;
+  }
+  return chunks[currentChunk] + blockSize * chunkOffset++;
+}
+
+void UpdateArena::deallocate(void* const block, const std::size_t size) {
+  if(!block) {
+    return;
+  }
+  if(size > blockSize) {
+    ::operator delete(block);
+    return;
+  }
+  live--;
+
+  FreeBlock* freed = static_cast<FreeBlock*>(block);
+  freed->next = freeList;
+  freeList = freed;
+}
+
+bool UpdateArena::reset() {
+  if(live > 0) {
+    return false;
+  }
+  freeList = nullptr;
+  currentChunk = 0;
+  chunkOffset = 0;
+  return true;
+}
+
+
+std::size_t UpdateArena::liveBlocks() const {
+  return live;
+}
+std::size_t UpdateArena::chunkAllocations() const {
+  return systemAllocations;
+}
@@ -0,0 +1,105 @@
+#ifndef UPDATE_ARENA_HPP
+#define UPDATE_ARENA_HPP
+
+#include <cstddef>
+#include <vector>
+
+
+class UpdateArena {
+private:
+  // Number of blocks carved out of each chunk requested from the system
+  static constexpr std::size_t blocksPerChunk = 512;
+
+  // Freed blocks are linked through their own storage
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  std::size_t blockSize;
+  std::vector<char*> chunks;
+
+  // Position of the next never-used block
+  std::size_t currentChunk;
+  std::size_t chunkOffset;
+
+  FreeBlock* freeList;
+
+  std::size_t live;
+  std::size_t systemAllocations;
+
+public:
+  /*
+   * Function: Constructor
+   * Description: Creates an empty arena that hands out blocks of at least the
+   *    given size. No memory is requested until the first allocation.
+   * Parameters:
+   *    blockSize (size_t): The size of each block, in bytes.
+   */
+  UpdateArena(std::size_t blockSize);
+
+  /*
+   * Functions: Copy/Move Constructor/Assignment
+   * Description: The arena owns raw memory that blocks point into, so it
+   *    can't be copied or moved.
+   */
+  UpdateArena(const UpdateArena&) = delete;
+  UpdateArena(UpdateArena&&) = delete;
+  UpdateArena& operator=(const UpdateArena&) = delete;
+  UpdateArena& operator=(UpdateArena&&) = delete;
+
+  /*
+   * Function: Destructor
+   * Description: Frees every chunk, as long as no blocks are still in use.
+   *    Chunks with live blocks are leaked rather than left dangling.
+   */
+  ~UpdateArena();
+
+  /*
+   * Function: local
+   * Description: Returns the arena used by GameUpdate objects and update
+   *    list nodes on the calling thread. Each thread has its own arena, so
+   *    games running on separate threads never share allocator state.
+   * Returns (UpdateArena&): The arena belonging to the current thread.
+   */
+  static UpdateArena& local();
+
+  /*
+   * Function: allocate
+   * Description: Returns a block of memory of the given size. Blocks are
+   *    reused from the free list first, then carved from the current chunk.
+   *    Requests larger than the block size fall back to the global heap.
+   * Parameters:
+   *    size (size_t): The number of bytes needed.
+   * Returns (void*): Uninitialized memory of at least the given size.
+   */
+  void* allocate(std::size_t size);
+
+  /*
+   * Function: deallocate
+   * Description: Returns a block to the arena for reuse.
+   * Parameters:
+   *    block (void*): Memory previously returned by allocate.
+   *    size (size_t): The size passed to allocate for this block.
+   */
+  void deallocate(void* block, std::size_t size);
+
+  /*
+   * Function: reset
+   * Description: If no blocks are in use, releases every block at once by
+   *    rewinding to the start of the first chunk. Chunks are kept so later
+   *    allocations don't go back to the system. Does nothing if any block
+   *    is still live.
+   * Returns (bool): True if the arena was rewound.
+   */
+  bool reset();
+
+  /*
+   * Functions: Statistics
+   * Description: Simple getters for the number of blocks currently in use,
+   *    and the number of chunks requested from the system so far.
+   */
+  std::size_t liveBlocks() const;
+  std::size_t chunkAllocations() const;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#include "updateText.hpp"
+
+#include <cstring>
+
+
+void UpdateText::assign(const std::string_view text) {
+  length = text.size();
+  char* dest = inlineText;
+  if(length > inlineCapacity) {
+    heapText = new char[length + 1];
+    dest = heapText;
+  }
+  std::memcpy(dest, text.data(), length);
+  dest[length] = '\0';
+}
+
+void UpdateText::release() {
+  delete[] heapText;
+  heapText = nullptr;
+}
+
+
+UpdateText::UpdateText() : length(0), heapText(nullptr) {
+  inlineText[0] = '\0';
+}
+
+UpdateText::UpdateText(const char* const text) : heapText(nullptr) {
+  assign(text ? std::string_view(text) : std::string_view());
+}
+UpdateText::UpdateText(const std::string& text) : heapText(nullptr) {
+  assign(text);
+}
+UpdateText::UpdateText(const std::string_view text) : heapText(nullptr) {
+  assign(text);
+}
+
+UpdateText::UpdateText(const UpdateText& other) : heapText(nullptr) {
+  assign(other.view());
+}
+UpdateText& UpdateText::operator=(const UpdateText& other) {
+  if(this != &other) {
+    release();
+    assign(other.view());
+  }
+  return *this;
+}
+
+UpdateText::~UpdateText() {
+  release();
+}
+
+
+std::string_view UpdateText::view() const {
+  if(heapText) {
+    return std::string_view(heapText, length);
+  }
+  return std::string_view(inlineText, length);
+}
+
+bool UpdateText::empty() const {
+  return length == 0;
+}
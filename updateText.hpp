@@ -0,0 +1,79 @@
+#ifndef UPDATE_TEXT_HPP
+#define UPDATE_TEXT_HPP
+
+#include <string>
+#include <string_view>
+
+
+class UpdateText {
+private:
+  // Long enough for item names and most single-line messages
+  static constexpr std::size_t inlineCapacity = 55;
+
+  std::size_t length;
+  // Null unless the text was too long to store inline
+  char* heapText;
+  char inlineText[inlineCapacity + 1];
+
+  /*
+   * Function: assign
+   * Description: Copies the given characters into this object, storing them
+   *    inline if they fit and on the heap otherwise.
+   * Parameters:
+   *    text (string_view): The characters to copy.
+   */
+  void assign(std::string_view text);
+
+  /*
+   * Function: release
+   * Description: Frees the heap copy of the text, if there is one.
+   */
+  void release();
+
+public:
+  /*
+   * Function: Default Constructor
+   * Description: Initializes the text to an empty string.
+   */
+  UpdateText();
+
+  /*
+   * Functions: Conversion Constructors
+   * Description: Copies the given text. These are implicit so a string
+   *    literal or std::string can be passed wherever UpdateText is expected.
+   * Parameters:
+   *    text: The text to store.
+   */
+  UpdateText(const char* text);
+  UpdateText(const std::string& text);
+  UpdateText(std::string_view text);
+
+  /*
+   * Functions: Copy Constructor/Assignment
+   * Description: Deep copies the text of the other object.
+   */
+  UpdateText(const UpdateText& other);
+  UpdateText& operator=(const UpdateText& other);
+
+  /*
+   * Function: Destructor
+   * Description: Frees the heap copy of the text, if there is one.
+   */
+  ~UpdateText();
+
+  /*
+   * Function: view
+   * Description: Returns a view of the stored text. The view is only valid
+   *    for as long as this object is unchanged.
+   * Returns (string_view): The stored text.
+   */
+  std::string_view view() const;
+
+  /*
+   * Function: empty
+   * Returns (bool): True if the stored text has no characters.
+   */
+  bool empty() const;
+};
+
+#endif